@@ -0,0 +1,75 @@
+#ifndef FT_BENCH_BENCH_HPP
+#define FT_BENCH_BENCH_HPP
+
+/*
+ * Shared helpers for the benchmarks in bench/. Each *_bench.cpp is its own
+ * program built at -O2 by `make bench`; they print one line per
+ * configuration so runs can be diffed across commits. Absolute numbers
+ * depend on the machine, the ratios are what the docs quote.
+ */
+
+#include <cstddef>
+#include <cstdio>
+#include <ctime>
+#include <memory>
+#include <sys/resource.h>
+
+namespace ft_bench
+{
+	inline double	now()
+	{
+		timespec	t;
+		clock_gettime(CLOCK_MONOTONIC, &t);
+		return t.tv_sec + t.tv_nsec * 1e-9;
+	}
+
+	// Peak resident set of this process so far, in KiB.
+	inline long	peak_rss_kb()
+	{
+		rusage	u;
+		getrusage(RUSAGE_SELF, &u);
+		return u.ru_maxrss;
+	}
+
+	// Keeps the optimizer from dropping a computed result.
+	template<class T>
+	inline void	keep(const T& v)
+	{
+		asm volatile("" : : "g"(&v) : "memory");
+	}
+
+	struct alloc_stats
+	{
+		static size_t	calls;
+		static size_t	bytes;
+
+		static void	reset() { calls = 0; bytes = 0; }
+	};
+
+	size_t	alloc_stats::calls = 0;
+	size_t	alloc_stats::bytes = 0;
+
+	// std::allocator that counts calls to allocate into alloc_stats.
+	template<class T>
+	struct counting_allocator : std::allocator<T>
+	{
+		typedef size_t	size_type;
+		typedef T*		pointer;
+
+		template<class U>
+		struct rebind { typedef counting_allocator<U> other; };
+
+		counting_allocator() {}
+		template<class U>
+		counting_allocator(const counting_allocator<U>&) {}
+
+		pointer	allocate(size_type n, const void* = 0)
+		{
+			++alloc_stats::calls;
+			alloc_stats::bytes += n * sizeof(T);
+			return std::allocator<T>::allocate(n);
+		}
+	};
+}
+
+#endif
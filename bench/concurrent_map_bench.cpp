@@ -0,0 +1,114 @@
+#include "bench/bench.hpp"
+#include "map/concurrent_map.hpp"
+#include "map/map.hpp"
+#include "utils/mutex.hpp"
+
+#include <pthread.h>
+#include <cstdlib>
+
+// 1 to 64 threads sharing 2^20 operations on a 100k key map, at 100%, 90%
+// and 50% reads. Writes alternate insert_or_assign and erase. The
+// baseline is ft::map behind one ft::mutex, plus ft::map run on one
+// thread with no lock at all.
+
+static const int	KEYS = 100000;
+static const int	TOTAL = 1 << 20;
+
+static ft::concurrent_map<int, int>	lock_free;
+static ft::map<int, int>			locked;
+static ft::mutex					locked_mutex;
+static int							per_thread;
+static int							read_percent;
+
+static void*	use_lock_free(void* arg)
+{
+	unsigned	seed = (unsigned)(long)arg;
+	long		found = 0;
+	int			value;
+
+	for (int i = 0; i < per_thread; ++i)
+	{
+		int	k = rand_r(&seed) % (2 * KEYS);
+		if (rand_r(&seed) % 100 < read_percent)
+			found += lock_free.find(k, value);
+		else if (k & 1)
+			lock_free.erase(k);
+		else
+			lock_free.insert_or_assign(k, i);
+	}
+	ft_bench::keep(found);
+	return 0;
+}
+
+static void*	use_locked(void* arg)
+{
+	unsigned	seed = (unsigned)(long)arg;
+	long		found = 0;
+
+	for (int i = 0; i < per_thread; ++i)
+	{
+		int							k = rand_r(&seed) % (2 * KEYS);
+		bool						read = rand_r(&seed) % 100 < read_percent;
+		ft::lock_guard<ft::mutex>	lock(locked_mutex);
+		if (read)
+			found += locked.count(k);
+		else if (k & 1)
+			locked.erase(k);
+		else
+			locked[k] = i;
+	}
+	ft_bench::keep(found);
+	return 0;
+}
+
+static double	run(int threads, void* (*worker)(void*))
+{
+	pthread_t	t[64];
+
+	per_thread = TOTAL / threads;
+	double	start = ft_bench::now();
+	for (long i = 0; i < threads; ++i)
+		pthread_create(&t[i], 0, worker, (void*)(i + 1));
+	for (int i = 0; i < threads; ++i)
+		pthread_join(t[i], 0);
+	return ft_bench::now() - start;
+}
+
+int	main()
+{
+	static const int	mixes[] = { 100, 90, 50 };
+
+	for (int i = 0; i < KEYS; ++i)
+	{
+		lock_free.insert(ft::make_pair(i * 2, i));
+		locked[i * 2] = i;
+	}
+	for (int m = 0; m < 3; ++m)
+	{
+		read_percent = mixes[m];
+		double		start = ft_bench::now();
+		unsigned	seed = 1;
+		long		found = 0;
+		for (int i = 0; i < TOTAL; ++i)
+		{
+			int	k = rand_r(&seed) % (2 * KEYS);
+			if (rand_r(&seed) % 100 < read_percent)
+				found += locked.count(k);
+			else if (k & 1)
+				locked.erase(k);
+			else
+				locked[k] = i;
+		}
+		ft_bench::keep(found);
+		double	baseline = ft_bench::now() - start;
+		std::printf("%3d%% reads, ft::map on 1 thread, no lock: %.2f Mops/s\n", read_percent, TOTAL / baseline / 1e6);
+		for (int threads = 1; threads <= 64; threads *= 2)
+		{
+			double	a = run(threads, use_lock_free);
+			double	b = run(threads, use_locked);
+			std::printf("%3d%% reads, %2d threads: concurrent_map %.2f Mops/s, ft::map + mutex %.2f Mops/s\n",
+				read_percent, threads, TOTAL / a / 1e6, TOTAL / b / 1e6);
+		}
+	}
+	return 0;
+}
@@ -0,0 +1,61 @@
+#include "bench/bench.hpp"
+#include "vector/concurrent_vector.hpp"
+#include "vector/vector.hpp"
+#include "utils/mutex.hpp"
+
+#include <pthread.h>
+
+// 1 to 64 producers appending 2^24 ints in total, against a mutex-guarded ft::vector.
+
+static const int	TOTAL = 1 << 24;
+static int			per_thread;
+
+static ft::concurrent_vector<int>*	lock_free;
+static ft::vector<int>*				locked;
+static ft::mutex					locked_mutex;
+
+static void*	push_lock_free(void*)
+{
+	for (int i = 0; i < per_thread; ++i)
+		lock_free->push_back(i);
+	return 0;
+}
+
+static void*	push_locked(void*)
+{
+	for (int i = 0; i < per_thread; ++i)
+	{
+		ft::lock_guard<ft::mutex>	l(locked_mutex);
+		locked->push_back(i);
+	}
+	return 0;
+}
+
+static double	run(int threads, void* (*producer)(void*))
+{
+	pthread_t	t[64];
+
+	per_thread = TOTAL / threads;
+	double	start = ft_bench::now();
+	for (int i = 0; i < threads; ++i)
+		pthread_create(&t[i], 0, producer, 0);
+	for (int i = 0; i < threads; ++i)
+		pthread_join(t[i], 0);
+	return ft_bench::now() - start;
+}
+
+int	main()
+{
+	for (int threads = 1; threads <= 64; threads *= 2)
+	{
+		lock_free = new ft::concurrent_vector<int>;
+		double	a = run(threads, push_lock_free);
+		delete lock_free;
+		locked = new ft::vector<int>;
+		double	b = run(threads, push_locked);
+		delete locked;
+		std::printf("%2d producers: concurrent_vector %.3fs (%.0f Mops/s), mutex+vector %.3fs (%.0f Mops/s)\n",
+			threads, a, TOTAL / a / 1e6, b, TOTAL / b / 1e6);
+	}
+	return 0;
+}
@@ -0,0 +1,69 @@
+#include "bench/bench.hpp"
+#include "map/cow_map.hpp"
+#include "map/map.hpp"
+
+#include <vector>
+
+// Hands a snapshot of a 2M entry map to one of four workers, then writes
+// one key, as a config publisher does. ft::map pays a full copy per
+// snapshot; cow_map pays one root path per write.
+
+static const int	SIZE = 2000000;
+
+static int	key(long i)
+{
+	return (int)(i * 7919 % SIZE);
+}
+
+int	main()
+{
+	ft::map<int, int>		plain;
+	ft::cow_map<int, int>	shared;
+
+	for (int i = 0; i < SIZE; ++i)
+	{
+		plain.insert(ft::make_pair(key(i), i));
+		shared.insert(ft::make_pair(key(i), i));
+	}
+
+	std::vector<ft::map<int, int> >	plain_workers(4);
+	double	start = ft_bench::now();
+	for (int round = 0; round < 8; ++round)
+	{
+		plain_workers[round % 4] = plain;
+		plain[key(round)] = round;
+	}
+	double	plain_cycle = (ft_bench::now() - start) / 8;
+
+	std::vector<ft::cow_map<int, int> >	workers(4);
+	start = ft_bench::now();
+	for (int round = 0; round < 20; ++round)
+	{
+		workers[round % 4] = shared;
+		shared[key(round)] = round;
+	}
+	double	first_cycles = (ft_bench::now() - start) / 20;
+	start = ft_bench::now();
+	for (int round = 0; round < 100000; ++round)
+	{
+		workers[round % 4] = shared;
+		shared[key(round)] = round;
+	}
+	double	steady_cycle = (ft_bench::now() - start) / 100000;
+
+	long	sum = 0;
+	start = ft_bench::now();
+	for (long i = 0; i < 1000000; ++i)
+		sum += plain.find(key(i * 104729))->second;
+	double	plain_find = (ft_bench::now() - start) / 1000000;
+	start = ft_bench::now();
+	for (long i = 0; i < 1000000; ++i)
+		sum += shared.find(key(i * 104729))->second;
+	double	shared_find = (ft_bench::now() - start) / 1000000;
+	ft_bench::keep(sum);
+
+	std::printf("ft::map     snapshot+write %.1f ms, find %.0f ns\n", plain_cycle * 1e3, plain_find * 1e9);
+	std::printf("ft::cow_map snapshot+write %.1f us (first 20), %.2f us steady, find %.0f ns\n",
+		first_cycles * 1e6, steady_cycle * 1e6, shared_find * 1e9);
+	return 0;
+}
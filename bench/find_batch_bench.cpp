@@ -0,0 +1,58 @@
+#include "bench/bench.hpp"
+#include "map/map.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+// find_batch against a loop of find on ft::map<int, int>, keys inserted in
+// random order, half of the lookups missing. Best of 3.
+
+static const size_t	LOOKUPS = 1 << 21;
+
+static void	run(size_t size)
+{
+	ft::map<int, int>	m;
+	std::vector<int>	keys;
+
+	std::srand(1);
+	for (size_t i = 0; i < size; ++i)
+		keys.push_back((int)i * 2);
+	std::random_shuffle(keys.begin(), keys.end());
+	for (size_t i = 0; i < size; ++i)
+		m.insert(ft::make_pair(keys[i], (int)i));
+	keys.clear();
+	for (size_t i = 0; i < LOOKUPS; ++i)
+		keys.push_back((int)(std::rand() % (size * 2)));
+
+	std::vector<ft::map<int, int>::iterator>	hits(keys.size());
+	double	loop = 1e9;
+	double	batch = 1e9;
+	for (int round = 0; round < 3; ++round)
+	{
+		double	start = ft_bench::now();
+		for (size_t i = 0; i < keys.size(); ++i)
+			hits[i] = m.find(keys[i]);
+		ft_bench::keep(hits[0]);
+		double	mid = ft_bench::now();
+		m.find_batch(keys.begin(), keys.end(), hits.begin());
+		ft_bench::keep(hits[0]);
+		double	end = ft_bench::now();
+		loop = std::min(loop, mid - start);
+		batch = std::min(batch, end - mid);
+	}
+	std::printf("%8lu keys: find %.0f ns, find_batch %.0f ns per key\n",
+		(unsigned long)m.size(), loop / LOOKUPS * 1e9, batch / LOOKUPS * 1e9);
+}
+
+int	main(int argc, char** argv)
+{
+	if (argc > 1)
+		run(std::strtoul(argv[1], 0, 10));
+	else
+	{
+		run(100000);
+		run(4000000);
+	}
+	return 0;
+}
@@ -0,0 +1,56 @@
+#include "bench/bench.hpp"
+#include "utils/growth_policy.hpp"
+#include "vector/vector.hpp"
+
+#include <sys/wait.h>
+#include <unistd.h>
+
+// Peak RSS, reallocations and final slack of 40M push_backs of int per
+// growth policy. Each policy runs in its own child process, since the
+// peak RSS of a process only goes up.
+
+static const size_t	COUNT = 40000000;
+
+template<class G>
+static void	run(const char* name)
+{
+	std::fflush(stdout);
+	pid_t	pid = fork();
+	if (pid != 0)
+	{
+		waitpid(pid, 0, 0);
+		return;
+	}
+
+	long	before = ft_bench::peak_rss_kb();
+	double	start = ft_bench::now();
+	size_t	reallocs = 0;
+	{
+		ft::vector<int, std::allocator<int>, G>	v;
+		size_t									capacity = 0;
+
+		for (size_t i = 0; i < COUNT; ++i)
+		{
+			v.push_back((int)i);
+			if (v.capacity() != capacity)
+			{
+				++reallocs;
+				capacity = v.capacity();
+			}
+		}
+		std::printf("%-14s %2lu reallocs, %6.1f ms, capacity %5.1f%% of size, peak RSS %4ld MB\n",
+			name, (unsigned long)reallocs, (ft_bench::now() - start) * 1e3,
+			100.0 * capacity / COUNT, (ft_bench::peak_rss_kb() - before) / 1024);
+	}
+	std::fflush(stdout);
+	_exit(0);
+}
+
+int	main()
+{
+	run<ft::growth_double>("double");
+	run<ft::growth_golden>("golden");
+	run<ft::growth_size_class>("size_class");
+	run<ft::growth_page_aligned>("page_aligned");
+	return 0;
+}
@@ -0,0 +1,64 @@
+#include "bench/bench.hpp"
+#include "vector/incremental_vector.hpp"
+#include "vector/vector.hpp"
+
+#include <x86intrin.h>
+
+// 50M int push_backs, log2 histogram of rdtsc cycles per call. For the
+// incremental vector, calls over 2^21 cycles are sorted by cause: a
+// growth step, the call that finished a migration and freed the old
+// block, or anything else (page faults, preemption).
+
+static const size_t	N = 50000000;
+
+template<class V>
+static void	run(const char* name)
+{
+	unsigned long long	hist[64] = { 0 };
+	unsigned long long	worst = 0;
+	unsigned long		grow = 0, freed = 0, other = 0;
+	V					v;
+	unsigned long long	total = __rdtsc();
+
+	for (size_t i = 0; i < N; ++i)
+	{
+		size_t				capacity = v.capacity();
+		bool				migrating = v.migrating();
+		unsigned long long	t = __rdtsc();
+		v.push_back((int)i);
+		t = __rdtsc() - t;
+		if (t > worst)
+			worst = t;
+		hist[63 - __builtin_clzll(t | 1)]++;
+		if (t > (1ULL << 21))
+		{
+			if (capacity != v.capacity())
+				++grow;
+			else if (migrating && !v.migrating())
+				++freed;
+			else
+				++other;
+		}
+	}
+	total = __rdtsc() - total;
+	ft_bench::keep(v[N / 2]);
+	std::printf("%s: %.1f cycles/op, max %llu, over 2^21: %lu growing, %lu freeing, %lu other\n",
+		name, (double)total / N, worst, grow, freed, other);
+	for (int b = 0; b < 64; ++b)
+		if (hist[b])
+			std::printf("  [2^%-2d, 2^%-2d) %llu\n", b, b + 1, hist[b]);
+}
+
+// ft::vector never migrates; this lets run() treat both alike.
+template<class T>
+struct plain_vector : ft::vector<T>
+{
+	bool	migrating() const { return false; }
+};
+
+int	main()
+{
+	run<plain_vector<int> >("ft::vector");
+	run<ft::incremental_vector<int> >("incremental_vector");
+	return 0;
+}
@@ -0,0 +1,70 @@
+#include "bench/bench.hpp"
+#include "map/map.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+#include <vector>
+
+// find, lower_bound and a full scan of ft::map<int, int>, keys inserted in
+// random order, half of the lookups missing. Best of 3. `make bench` also
+// builds this file with -DRB_TREE_PREFETCH as map_descent_prefetch_bench,
+// so the two runs side by side give the prefetch matrix.
+
+static const size_t	LOOKUPS = 1 << 21;
+
+static void	run(size_t size)
+{
+	std::vector<int>	keys;
+	ft::map<int, int>	m;
+
+	std::srand(1);
+	for (size_t i = 0; i < size; ++i)
+		keys.push_back((int)i * 2);
+	std::random_shuffle(keys.begin(), keys.end());
+	for (size_t i = 0; i < size; ++i)
+		m.insert(ft::make_pair(keys[i], (int)i));
+	keys.clear();
+	for (size_t i = 0; i < LOOKUPS; ++i)
+		keys.push_back((int)(std::rand() % size) * 2 + (int)(i & 1));
+
+	double	find = 1e9;
+	double	lower = 1e9;
+	double	scan = 1e9;
+	long	sink = 0;
+	for (int round = 0; round < 3; ++round)
+	{
+		double	t0 = ft_bench::now();
+		for (size_t i = 0; i < keys.size(); ++i)
+			sink += m.find(keys[i]) != m.end();
+		double	t1 = ft_bench::now();
+		for (size_t i = 0; i < keys.size(); ++i)
+			sink += m.lower_bound(keys[i]) != m.end();
+		double	t2 = ft_bench::now();
+		for (ft::map<int, int>::iterator it = m.begin(); it != m.end(); ++it)
+			sink += it->second;
+		double	t3 = ft_bench::now();
+		find = std::min(find, t1 - t0);
+		lower = std::min(lower, t2 - t1);
+		scan = std::min(scan, t3 - t2);
+	}
+	ft_bench::keep(sink);
+#ifdef RB_TREE_PREFETCH
+	const char*	mode = "on ";
+#else
+	const char*	mode = "off";
+#endif
+	std::printf("prefetch %s %8lu keys: find %.0f ns, lower_bound %.0f ns, scan %.1f ns/elem\n",
+		mode, (unsigned long)size, find / LOOKUPS * 1e9, lower / LOOKUPS * 1e9, scan / size * 1e9);
+}
+
+int	main(int argc, char** argv)
+{
+	if (argc > 1)
+		run(std::strtoul(argv[1], 0, 10));
+	else
+	{
+		run(100000);
+		run(4000000);
+	}
+	return 0;
+}
@@ -0,0 +1,85 @@
+#include "bench/bench.hpp"
+#include "vector/mapped_vector.hpp"
+#include "vector/vector.hpp"
+
+#include <fcntl.h>
+#include <fstream>
+#include <string>
+#include <unistd.h>
+
+// Startup of a 2^27-int (512 MB) table: the read-and-push_back load loop
+// against opening an ft::mapped_vector, each until the table is usable and
+// then through one full scan. The cold runs first drop the files from the
+// page cache with posix_fadvise(DONTNEED). The files go in argv[1], /tmp
+// by default, which must not be a tmpfs for the cold runs to mean anything.
+
+static const size_t	N = 1UL << 27;
+
+static void	evict(const std::string& path)
+{
+	int	fd = open(path.c_str(), O_RDONLY);
+	fdatasync(fd);
+	posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+	close(fd);
+}
+
+static void	load_loop(const std::string& path)
+{
+	double				start = ft_bench::now();
+	ft::vector<int>		v;
+	std::ifstream		in(path.c_str(), std::ios::binary);
+	int					x;
+	while (in.read(reinterpret_cast<char*>(&x), sizeof(x)))
+		v.push_back(x);
+	double	ready = ft_bench::now() - start;
+	long	sum = 0;
+	for (size_t i = 0; i < v.size(); ++i)
+		sum += v[i];
+	ft_bench::keep(sum);
+	std::printf("  load loop      ready %9.4f s, + scan %.3f s\n", ready, ft_bench::now() - start);
+}
+
+static void	mapped(const std::string& path)
+{
+	double					start = ft_bench::now();
+	ft::mapped_vector<int>	m(path.c_str(), ft::mapped_vector<int>::read_only);
+	double					ready = ft_bench::now() - start;
+	const int*				d = m.data();
+	long					sum = 0;
+	for (size_t i = 0; i < m.size(); ++i)
+		sum += d[i];
+	ft_bench::keep(sum);
+	std::printf("  mapped_vector  ready %9.4f s, + scan %.3f s\n", ready, ft_bench::now() - start);
+}
+
+int	main(int argc, char** argv)
+{
+	std::string	dir = argc > 1 ? argv[1] : "/tmp";
+	std::string	raw = dir + "/ft_mapped_vector_bench.raw";
+	std::string	table = dir + "/ft_mapped_vector_bench.bin";
+
+	{
+		std::remove(table.c_str());
+		ft::mapped_vector<int>	m(table.c_str());
+		std::ofstream			out(raw.c_str(), std::ios::binary);
+		m.reserve(N);
+		for (size_t i = 0; i < N; ++i)
+		{
+			int	x = (int)(i * 2654435761u);
+			m.push_back(x);
+			out.write(reinterpret_cast<char*>(&x), sizeof(x));
+		}
+		m.sync();
+	}
+	evict(raw);
+	evict(table);
+	std::printf("cold:\n");
+	load_loop(raw);
+	mapped(table);
+	std::printf("warm:\n");
+	load_loop(raw);
+	mapped(table);
+	std::remove(raw.c_str());
+	std::remove(table.c_str());
+	return 0;
+}
@@ -0,0 +1,52 @@
+#include "bench/bench.hpp"
+#include "utils/mmap_allocator.hpp"
+#include "vector/vector.hpp"
+
+#include <cstdlib>
+
+// The push_back loop of intra_main_ft.cpp: MAX_RAM bytes of 4 KB Buffers,
+// with the default allocator and with ft::mmap_allocator. An argument
+// scales MAX_RAM down, e.g. 0.25 for a quarter.
+
+#define MAX_RAM 694967296
+#define BUFFER_SIZE 4096
+
+struct Buffer
+{
+	int		idx;
+	char	buff[BUFFER_SIZE];
+};
+
+template<class V>
+static double	fill(int count)
+{
+	double	start = ft_bench::now();
+	V		v;
+	Buffer	b;
+
+	for (int i = 0; i < count; ++i)
+	{
+		b.idx = i;
+		v.push_back(b);
+	}
+	for (int i = 0; i < count; i += 97)
+		if (v[i].idx != i)
+			std::abort();
+	return ft_bench::now() - start;
+}
+
+int	main(int argc, char** argv)
+{
+	double	scale = argc > 1 ? std::atof(argv[1]) : 1.0;
+	int		count = (int)(MAX_RAM * scale / sizeof(Buffer));
+
+	double	plain = fill<ft::vector<Buffer> >(count);
+	double	mapped = fill<ft::vector<Buffer, ft::mmap_allocator<Buffer> > >(count);
+
+	ft::mmap_allocator_counters&	stats = ft::mmap_allocator_stats();
+	std::printf("%d Buffers: std::allocator %.2f s, mmap_allocator %.2f s\n", count, plain, mapped);
+	std::printf("mmap_allocator: %lu remaps avoided copying %lu bytes, %lu copies moved %lu bytes\n",
+		(unsigned long)stats.remaps.load(), (unsigned long)stats.bytes_remapped.load(),
+		(unsigned long)stats.copies.load(), (unsigned long)stats.bytes_copied.load());
+	return 0;
+}
@@ -0,0 +1,140 @@
+#include "bench/bench.hpp"
+#include "map/map.hpp"
+#include "map/persistent_map.hpp"
+#include "utils/atomic.hpp"
+#include "utils/mutex.hpp"
+
+#include <pthread.h>
+#include <cstdlib>
+#include <unistd.h>
+
+// Snapshot and write cost on a 1M entry map, then 2 s of three readers
+// against one writer: readers look keys up in their own snapshot, which
+// the writer republishes every 64 writes, against ft::map behind a mutex.
+
+static const int	SIZE = 1000000;
+
+static ft::persistent_map<int, int>	live;
+static ft::persistent_map<int, int>	published;
+static ft::map<int, int>			locked;
+static ft::mutex					mutex;
+static ft::atomic<int>				stop(0);
+static ft::atomic<long>				reads(0);
+static ft::atomic<long>				writes(0);
+static bool							use_snapshots;
+
+static void*	write_keys(void*)
+{
+	unsigned	seed = 1;
+	long		n = 0;
+
+	while (!stop.load(ft::memory_order_relaxed))
+	{
+		int	k = rand_r(&seed) % (2 * SIZE);
+		if (use_snapshots)
+		{
+			live.insert_or_assign(k, k);
+			if ((++n & 63) == 0)
+			{
+				ft::lock_guard<ft::mutex>	lock(mutex);
+				published = live;
+			}
+		}
+		else
+		{
+			ft::lock_guard<ft::mutex>	lock(mutex);
+			locked[k] = k;
+			++n;
+		}
+	}
+	writes.store(n);
+	return 0;
+}
+
+static void*	read_keys(void*)
+{
+	unsigned	seed = 2;
+	long		n = 0;
+	long		found = 0;
+
+	while (!stop.load(ft::memory_order_relaxed))
+	{
+		if (use_snapshots)
+		{
+			ft::persistent_map<int, int>	snap;
+			{
+				ft::lock_guard<ft::mutex>	lock(mutex);
+				snap = published;
+			}
+			for (int i = 0; i < 1000; ++i)
+				found += snap.count(rand_r(&seed) % (2 * SIZE));
+		}
+		else
+			for (int i = 0; i < 1000; ++i)
+			{
+				ft::lock_guard<ft::mutex>	lock(mutex);
+				found += locked.count(rand_r(&seed) % (2 * SIZE));
+			}
+		n += 1000;
+	}
+	ft_bench::keep(found);
+	reads.fetch_add(n);
+	return 0;
+}
+
+int	main()
+{
+	for (int i = 0; i < SIZE; ++i)
+	{
+		live.insert(ft::make_pair(i * 2, i));
+		locked[i * 2] = i;
+	}
+	published = live;
+
+	long	sink = 0;
+	double	start = ft_bench::now();
+	for (int i = 0; i < 1000; ++i)
+		sink += live.snapshot().size();
+	std::printf("persistent_map snapshot %.1f ns\n", (ft_bench::now() - start) * 1e9 / 1000);
+	start = ft_bench::now();
+	{
+		ft::map<int, int>	copy(locked);
+		sink += copy.size();
+	}
+	std::printf("ft::map copy %.1f ms\n", (ft_bench::now() - start) * 1e3);
+	ft_bench::keep(sink);
+
+	std::srand(1);
+	start = ft_bench::now();
+	for (int i = 0; i < 200000; ++i)
+		live.insert_or_assign(std::rand() % (2 * SIZE), i);
+	std::printf("persistent_map write %.0f ns\n", (ft_bench::now() - start) * 1e9 / 200000);
+	start = ft_bench::now();
+	for (int i = 0; i < 200000; ++i)
+		locked[std::rand() % (2 * SIZE)] = i;
+	std::printf("ft::map write %.0f ns\n", (ft_bench::now() - start) * 1e9 / 200000);
+
+	for (int mode = 0; mode < 2; ++mode)
+	{
+		pthread_t	writer;
+		pthread_t	readers[3];
+
+		use_snapshots = mode == 0;
+		stop.store(0);
+		reads.store(0);
+		start = ft_bench::now();
+		pthread_create(&writer, 0, write_keys, 0);
+		for (int i = 0; i < 3; ++i)
+			pthread_create(&readers[i], 0, read_keys, 0);
+		usleep(2000000);
+		stop.store(1);
+		pthread_join(writer, 0);
+		for (int i = 0; i < 3; ++i)
+			pthread_join(readers[i], 0);
+		double	elapsed = ft_bench::now() - start;
+		std::printf("%s: reads %.2f M/s, writes %.2f M/s\n",
+			use_snapshots ? "persistent_map snapshots" : "ft::map + mutex",
+			reads.load() / elapsed / 1e6, writes.load() / elapsed / 1e6);
+	}
+	return 0;
+}
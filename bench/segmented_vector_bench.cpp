@@ -0,0 +1,44 @@
+#include "bench/bench.hpp"
+#include "vector/segmented_vector.hpp"
+#include "vector/vector.hpp"
+
+#include <algorithm>
+#include <vector>
+#include <x86intrin.h>
+
+// Per-call push_back latency in cycles (rdtsc) over 50M ints, sorted into
+// percentiles. The tail is where the containers differ: ft::vector copies
+// the whole array when it doubles, segmented_vector allocates one chunk.
+
+static const size_t	N = 50000000;
+
+template<class V>
+static void	run(const char* name, std::vector<unsigned>& lat)
+{
+	V					v;
+	unsigned long long	total = __rdtsc();
+
+	for (size_t i = 0; i < N; ++i)
+	{
+		unsigned long long	t = __rdtsc();
+		v.push_back((int)i);
+		lat[i] = (unsigned)(__rdtsc() - t);
+	}
+	total = __rdtsc() - total;
+	ft_bench::keep(v[N / 2]);
+	std::sort(lat.begin(), lat.end());
+	std::printf("%-18s p50 %4u p99 %4u p99.9 %5u p99.99 %6u max %10u, %.1f cycles/op\n", name,
+		lat[N / 2], lat[N / 100 * 99], lat[N / 1000 * 999], lat[N / 10000 * 9999], lat[N - 1], (double)total / N);
+}
+
+int	main()
+{
+	std::vector<unsigned>	lat(N);
+
+	for (int round = 0; round < 2; ++round)
+	{
+		run<ft::vector<int> >("ft::vector", lat);
+		run<ft::segmented_vector<int> >("segmented_vector", lat);
+	}
+	return 0;
+}
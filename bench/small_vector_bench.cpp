@@ -0,0 +1,39 @@
+#include "bench/bench.hpp"
+#include "vector/small_vector.hpp"
+#include "vector/vector.hpp"
+
+#include <vector>
+
+// 2 million short-lived vectors of 6 ints each, as a request handler
+// builds them: allocator calls and time per vector.
+
+static const int	ROUNDS = 2000000;
+
+template<class V>
+static void	run(const char* name)
+{
+	long	sum = 0;
+
+	ft_bench::alloc_stats::reset();
+	double	start = ft_bench::now();
+	for (int i = 0; i < ROUNDS; ++i)
+	{
+		V	v;
+		for (int k = 0; k < 6; ++k)
+			v.push_back(i + k);
+		sum += v[3];
+	}
+	double	elapsed = ft_bench::now() - start;
+	ft_bench::keep(sum);
+	std::printf("%-24s %6.1f ns per vector, %lu allocations\n",
+		name, elapsed * 1e9 / ROUNDS, (unsigned long)ft_bench::alloc_stats::calls);
+}
+
+int	main()
+{
+	run<ft::vector<int, ft_bench::counting_allocator<int> > >("ft::vector");
+	run<std::vector<int, ft_bench::counting_allocator<int> > >("std::vector");
+	run<ft::small_vector<int, 8, ft_bench::counting_allocator<int> > >("ft::small_vector<int, 8>");
+	run<ft::small_vector<int, 4, ft_bench::counting_allocator<int> > >("ft::small_vector<int, 4>");
+	return 0;
+}
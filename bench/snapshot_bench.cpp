@@ -0,0 +1,104 @@
+#include "bench/bench.hpp"
+#include "utils/snapshot.hpp"
+
+#include <fstream>
+#include <string>
+
+// Saving and loading a 2M-entry int->int map and 50M doubles, per-element
+// stream I/O against snapshots, then opening the 400 MB vector snapshot
+// with and without the checksum pass. Files go in argv[1], /tmp by default.
+
+static const int	ENTRIES = 2000000;
+static const size_t	DOUBLES = 50000000;
+
+int	main(int argc, char** argv)
+{
+	std::string	dir = argc > 1 ? argv[1] : "/tmp";
+	std::string	stream = dir + "/ft_snapshot_bench.raw";
+	std::string	snap = dir + "/ft_snapshot_bench.snap";
+
+	ft::map<int, int>	m;
+	for (int i = 0; i < ENTRIES; ++i)
+		m[i * 7] = i;
+	ft::vector<double>	v(DOUBLES, 1.5);
+
+	double	start = ft_bench::now();
+	{
+		std::ofstream	out(stream.c_str(), std::ios::binary);
+		for (ft::map<int, int>::iterator it = m.begin(); it != m.end(); ++it)
+		{
+			out.write(reinterpret_cast<const char*>(&it->first), sizeof(int));
+			out.write(reinterpret_cast<const char*>(&it->second), sizeof(int));
+		}
+	}
+	double	write_stream = ft_bench::now() - start;
+	start = ft_bench::now();
+	ft::save_snapshot(snap.c_str(), m);
+	double	write_snap = ft_bench::now() - start;
+	start = ft_bench::now();
+	{
+		std::ifstream		in(stream.c_str(), std::ios::binary);
+		ft::map<int, int>	r;
+		int					k, x;
+		while (in.read(reinterpret_cast<char*>(&k), sizeof(k)) && in.read(reinterpret_cast<char*>(&x), sizeof(x)))
+			r.insert(ft::make_pair(k, x));
+		ft_bench::keep(r.size());
+	}
+	double	load_stream = ft_bench::now() - start;
+	start = ft_bench::now();
+	{
+		ft::snapshot		s(snap.c_str());
+		ft::map<int, int>	r;
+		ft::load_snapshot(s, r);
+		ft_bench::keep(r.size());
+	}
+	std::printf("map:    write stream %.3f s, snapshot %.3f s; load stream + insert %.3f s, snapshot %.3f s\n",
+		write_stream, write_snap, load_stream, ft_bench::now() - start);
+
+	start = ft_bench::now();
+	{
+		std::ofstream	out(stream.c_str(), std::ios::binary);
+		for (size_t i = 0; i < v.size(); ++i)
+			out.write(reinterpret_cast<const char*>(&v[i]), sizeof(double));
+	}
+	write_stream = ft_bench::now() - start;
+	start = ft_bench::now();
+	ft::save_snapshot(snap.c_str(), v);
+	write_snap = ft_bench::now() - start;
+	start = ft_bench::now();
+	{
+		std::ifstream		in(stream.c_str(), std::ios::binary);
+		ft::vector<double>	r;
+		double				d;
+		while (in.read(reinterpret_cast<char*>(&d), sizeof(d)))
+			r.push_back(d);
+		ft_bench::keep(r.size());
+	}
+	load_stream = ft_bench::now() - start;
+	start = ft_bench::now();
+	{
+		ft::snapshot		s(snap.c_str());
+		ft::vector<double>	r;
+		ft::load_snapshot(s, r);
+		ft_bench::keep(r.size());
+	}
+	std::printf("vector: write stream %.3f s, snapshot %.3f s; load stream + push_back %.3f s, snapshot %.3f s\n",
+		write_stream, write_snap, load_stream, ft_bench::now() - start);
+
+	start = ft_bench::now();
+	{
+		ft::snapshot	s(snap.c_str(), false);
+		ft_bench::keep(s.elements<double>()[123]);
+	}
+	double	unverified = ft_bench::now() - start;
+	start = ft_bench::now();
+	{
+		ft::snapshot	s(snap.c_str());
+		ft_bench::keep(s.size());
+	}
+	std::printf("open 400 MB vector snapshot: %.3f ms unverified, %.1f ms verified\n",
+		unverified * 1e3, (ft_bench::now() - start) * 1e3);
+	std::remove(stream.c_str());
+	std::remove(snap.c_str());
+	return 0;
+}
@@ -0,0 +1,53 @@
+#include "bench/bench.hpp"
+#include "vector/soa_vector.hpp"
+
+// Sums the int field of 50M ft::pair<int, double> rows, average of 5
+// passes: an ft::vector of pairs strides over the doubles, soa_vector
+// reads only the int column, through its span or its row iterator.
+
+static const size_t	N = 50000000;
+
+typedef ft::pair<int, double>	row;
+typedef ft::soa_vector<row>		columns;
+
+int	main()
+{
+	ft::vector<row>	rows;
+	columns			soa;
+	long			sum = 0;
+
+	rows.reserve(N);
+	soa.reserve(N);
+	for (size_t i = 0; i < N; ++i)
+	{
+		rows.push_back(ft::make_pair((int)(i & 1023), i * 0.5));
+		soa.push_back(ft::make_pair((int)(i & 1023), i * 0.5));
+	}
+
+	for (int round = 0; round < 2; ++round)
+	{
+		double	start = ft_bench::now();
+		for (int r = 0; r < 5; ++r)
+			for (size_t i = 0; i < N; ++i)
+				sum += rows[i].first;
+		std::printf("ft::vector<pair>          %.4f s\n", (ft_bench::now() - start) / 5);
+
+		start = ft_bench::now();
+		for (int r = 0; r < 5; ++r)
+		{
+			ft::span<const int>	c = static_cast<const columns&>(soa).first_column();
+			const int*			p = c.data();
+			for (size_t i = 0; i < c.size(); ++i)
+				sum += p[i];
+		}
+		std::printf("soa_vector first_column() %.4f s\n", (ft_bench::now() - start) / 5);
+
+		start = ft_bench::now();
+		for (int r = 0; r < 5; ++r)
+			for (columns::const_iterator it = soa.begin(); it != soa.end(); ++it)
+				sum += (*it).first;
+		std::printf("soa_vector row iterator   %.4f s\n", (ft_bench::now() - start) / 5);
+	}
+	ft_bench::keep(sum);
+	return 0;
+}
@@ -0,0 +1,41 @@
+#include "bench/bench.hpp"
+#include "vector/vector.hpp"
+
+#include <vector>
+
+// Sizes a 64 MiB ft::vector<char> receive buffer 20 times: zero-filling
+// resize, resize_uninitialized, and 4 KiB appends as reads would deliver.
+
+static const size_t	SIZE = 64 << 20;
+
+int	main()
+{
+	static const char*	names[] = { "std::vector resize", "resize", "resize_uninitialized", "append 4 KiB chunks" };
+	char				chunk[4096] = { 1 };
+
+	for (int mode = 0; mode < 4; ++mode)
+	{
+		double	start = ft_bench::now();
+		for (int round = 0; round < 20; ++round)
+		{
+			if (mode == 0)
+			{
+				std::vector<char>	v;
+				v.resize(SIZE);
+				ft_bench::keep(v[SIZE / 2]);
+				continue;
+			}
+			ft::vector<char>	v;
+			if (mode == 1)
+				v.resize(SIZE);
+			else if (mode == 2)
+				v.resize_uninitialized(SIZE);
+			else
+				for (size_t i = 0; i < SIZE / sizeof(chunk); ++i)
+					v.append(chunk, sizeof(chunk));
+			ft_bench::keep(v[SIZE / 2]);
+		}
+		std::printf("%-22s %.4f s\n", names[mode], ft_bench::now() - start);
+	}
+	return 0;
+}
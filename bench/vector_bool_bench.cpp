@@ -0,0 +1,84 @@
+#include "bench/bench.hpp"
+#include "vector/vector.hpp"
+
+// 2^30 flags packed in ft::vector<bool> against one byte per flag in
+// ft::vector<char>: memory, push_back, count, a &= b, and visiting the
+// set bits of a 20% dense bitmap. count and &= are the best of 5.
+
+static const size_t	N = 1UL << 30;
+
+static bool	flag(size_t i)
+{
+	return (i * 2654435761u >> 7) % 5 == 0;
+}
+
+int	main()
+{
+	ft::vector<bool>	a, b;
+	ft::vector<char>	ca, cb;
+
+	double	start = ft_bench::now();
+	for (size_t i = 0; i < N; ++i)
+		a.push_back(flag(i));
+	double	packed = ft_bench::now() - start;
+	start = ft_bench::now();
+	for (size_t i = 0; i < N; ++i)
+		ca.push_back(flag(i));
+	double	bytes = ft_bench::now() - start;
+	std::printf("memory       packed %5lu MB, bytes %5lu MB\n",
+		(unsigned long)(a.word_count() * sizeof(ft::bit_word) >> 20), (unsigned long)(ca.capacity() >> 20));
+	std::printf("push_back    packed %.3f s, bytes %.3f s\n", packed, bytes);
+
+	size_t	sum = 0, check = 0;
+	start = ft_bench::now();
+	for (size_t i = a.find_first(); i != a.size(); i = a.find_next(i))
+		sum += i;
+	packed = ft_bench::now() - start;
+	start = ft_bench::now();
+	for (size_t i = 0; i < N; ++i)
+		if (ca[i])
+			check += i;
+	bytes = ft_bench::now() - start;
+	std::printf("set bits     packed %.3f s, bytes %.3f s%s\n", packed, bytes, sum == check ? "" : " MISMATCH");
+
+	packed = bytes = 1e9;
+	for (int round = 0; round < 5; ++round)
+	{
+		start = ft_bench::now();
+		sum = a.count();
+		double	t = ft_bench::now() - start;
+		packed = t < packed ? t : packed;
+		start = ft_bench::now();
+		check = 0;
+		for (size_t i = 0; i < N; ++i)
+			check += ca[i];
+		t = ft_bench::now() - start;
+		bytes = t < bytes ? t : bytes;
+	}
+	std::printf("count        packed %.3f s (%.1f Gflags/s), bytes %.3f s (%.1f Gflags/s)%s\n",
+		packed, N / packed / 1e9, bytes, N / bytes / 1e9, sum == check ? "" : " MISMATCH");
+
+	b.resize(N);
+	cb.resize(N);
+	for (size_t i = 0; i < N; i += 3)
+	{
+		b[i] = true;
+		cb[i] = 1;
+	}
+	packed = bytes = 1e9;
+	for (int round = 0; round < 5; ++round)
+	{
+		start = ft_bench::now();
+		a &= b;
+		double	t = ft_bench::now() - start;
+		packed = t < packed ? t : packed;
+		start = ft_bench::now();
+		for (size_t i = 0; i < N; ++i)
+			ca[i] &= cb[i];
+		t = ft_bench::now() - start;
+		bytes = t < bytes ? t : bytes;
+	}
+	ft_bench::keep(ca[N / 3]);
+	std::printf("a &= b       packed %.3f s, bytes %.3f s\n", packed, bytes);
+	return 0;
+}
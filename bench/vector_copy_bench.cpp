@@ -0,0 +1,50 @@
+#include "bench/bench.hpp"
+#include "vector/vector.hpp"
+
+#include <vector>
+
+// Copy-heavy loops on 4096-int vectors: operator= into a vector that
+// already has room, and the copy constructor, 200000 times each. Then
+// copies of a one-element vector holding 1 GiB of capacity.
+
+template<class V>
+static void	copies(const char* name)
+{
+	V		src(4096, 3);
+	V		dst;
+	double	start = ft_bench::now();
+	for (int i = 0; i < 200000; ++i)
+	{
+		dst = src;
+		ft_bench::keep(dst[i % 4096]);
+	}
+	double	assign = ft_bench::now() - start;
+
+	start = ft_bench::now();
+	for (int i = 0; i < 200000; ++i)
+	{
+		V	copy(src);
+		ft_bench::keep(copy[5]);
+	}
+	std::printf("%-12s operator= %.3f s, copy ctor %.3f s\n", name, assign, ft_bench::now() - start);
+}
+
+int	main()
+{
+	copies<std::vector<int> >("std::vector");
+	copies<ft::vector<int> >("ft::vector");
+
+	ft::vector<int, ft_bench::counting_allocator<int> >	sparse;
+	sparse.reserve(1 << 28);
+	sparse.push_back(1);
+	ft_bench::alloc_stats::reset();
+	double	start = ft_bench::now();
+	for (int i = 0; i < 1000; ++i)
+	{
+		ft::vector<int, ft_bench::counting_allocator<int> >	copy(sparse);
+		ft_bench::keep(copy[0]);
+	}
+	std::printf("1000 copies of 1 element with 1 GiB capacity: %.4f s, %lu bytes allocated\n",
+		ft_bench::now() - start, (unsigned long)ft_bench::alloc_stats::bytes);
+	return 0;
+}
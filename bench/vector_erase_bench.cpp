@@ -0,0 +1,56 @@
+#include "bench/bench.hpp"
+#include "vector/vector.hpp"
+
+#include <string>
+#include <vector>
+
+// A sliding window of 10000 elements: each step pushes one element at the
+// back and drops one at the front, with erase(begin()) or erase_front(1).
+
+static const int	WINDOW = 10000;
+
+template<class V>
+static double	slide_erase(int steps, const typename V::value_type& value)
+{
+	V	v(WINDOW, value);
+
+	double	start = ft_bench::now();
+	for (int i = 0; i < steps; ++i)
+	{
+		v.push_back(value);
+		v.erase(v.begin());
+	}
+	ft_bench::keep(v[0]);
+	return ft_bench::now() - start;
+}
+
+template<class T>
+static double	slide_erase_front(int steps, const T& value)
+{
+	ft::vector<T>	v(WINDOW, value);
+
+	double	start = ft_bench::now();
+	for (int i = 0; i < steps; ++i)
+	{
+		v.push_back(value);
+		v.erase_front(1);
+	}
+	ft_bench::keep(v[0]);
+	return ft_bench::now() - start;
+}
+
+template<class T>
+static void	run(const char* name, int steps, const T& value)
+{
+	std::printf("%-11s: ft::vector erase %.0f ns, std::vector erase %.0f ns, erase_front %.1f ns per step\n",
+		name, slide_erase<ft::vector<T> >(steps, value) * 1e9 / steps,
+		slide_erase<std::vector<T> >(steps, value) * 1e9 / steps,
+		slide_erase_front(steps, value) * 1e9 / steps);
+}
+
+int	main()
+{
+	run("int", 200000, 7);
+	run("std::string", 10000, std::string(24, 'x'));
+	return 0;
+}
@@ -0,0 +1,55 @@
+#include "bench/bench.hpp"
+#include "vector/vector.hpp"
+
+#include <algorithm>
+#include <cstdlib>
+
+// Removes 1%, 50% and 99% of 10^6 random ints, 20 times each: the
+// branchless compaction erase_if uses for trivially copyable types, the
+// branchy one it uses otherwise, and std::remove_if plus erase.
+
+struct below
+{
+	int	limit;
+
+	explicit below(int l) : limit(l) {}
+	bool	operator()(int x) const { return x < limit; }
+};
+
+int	main()
+{
+	static const int	rates[] = { 1, 50, 99 };
+
+	for (int r = 0; r < 3; ++r)
+	{
+		double	branchless = 0;
+		double	branchy = 0;
+		double	std_remove = 0;
+		for (int round = 0; round < 20; ++round)
+		{
+			ft::vector<int>	v;
+			std::srand(round);
+			for (int i = 0; i < 1000000; ++i)
+				v.push_back(std::rand() % 100);
+			ft::vector<int>	w = v;
+			ft::vector<int>	x = v;
+
+			double	start = ft_bench::now();
+			ft::erase_if(v, below(rates[r]));
+			double	t1 = ft_bench::now();
+			int*	end = ft::compact(w.data(), w.data() + w.size(), below(rates[r]), ft::false_type());
+			w.erase(ft::vector<int>::iterator(end), w.end());
+			double	t2 = ft_bench::now();
+			x.erase(std::remove_if(x.begin(), x.end(), below(rates[r])), x.end());
+			double	t3 = ft_bench::now();
+			if (v.size() != w.size() || v.size() != x.size())
+				std::abort();
+			branchless += t1 - start;
+			branchy += t2 - t1;
+			std_remove += t3 - t2;
+		}
+		std::printf("%2d%% removed: branchless %.3f s, branchy %.3f s, std::remove_if %.3f s\n",
+			rates[r], branchless, branchy, std_remove);
+	}
+	return 0;
+}
@@ -0,0 +1,44 @@
+#include "bench/bench.hpp"
+#include "vector/vector.hpp"
+
+#include <vector>
+
+// assign(n, value) into a vector whose capacity is already reserved and
+// half faulted in, best of 5, for a 1 GiB fill (past the non-temporal
+// threshold) and a 1 MiB fill (cache resident, repeated 256 times).
+
+template<class V, class T>
+static void	fill(const char* name, const T& value, size_t bytes)
+{
+	const size_t	n = bytes / sizeof(T);
+	const int		reps = bytes < (64 << 20) ? 256 : 1;
+	double			best = 1e9;
+
+	{ V warm(n, value); }
+	for (int round = 0; round < 5; ++round)
+	{
+		V	v(n / 2, value);
+		v.reserve(n);
+		double	start = ft_bench::now();
+		for (int r = 0; r < reps; ++r)
+			v.assign(n, value);
+		double	t = (ft_bench::now() - start) / reps;
+		ft_bench::keep(v[n - 1]);
+		if (t < best)
+			best = t;
+	}
+	std::printf("%-28s %4lu MiB: %6.2f GB/s\n", name, (unsigned long)(bytes >> 20), bytes / best / 1e9);
+}
+
+int	main()
+{
+	for (size_t bytes = 1UL << 30; bytes >= 1UL << 20; bytes >>= 10)
+	{
+		fill<ft::vector<int> >("ft::vector<int> 0", 0, bytes);
+		fill<ft::vector<int> >("ft::vector<int> 7", 7, bytes);
+		fill<std::vector<int> >("std::vector<int> 7", 7, bytes);
+		fill<ft::vector<double> >("ft::vector<double> 1.5", 1.5, bytes);
+		fill<std::vector<double> >("std::vector<double> 1.5", 1.5, bytes);
+	}
+	return 0;
+}
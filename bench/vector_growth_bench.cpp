@@ -0,0 +1,70 @@
+#include "bench/bench.hpp"
+#include "vector/vector.hpp"
+
+#include <algorithm>
+#include <cstring>
+#include <string>
+#include <vector>
+
+// push_back growth from an empty vector, ft::vector against std::vector.
+// buffer is the 4 KB struct of intra_main_ft.cpp and relocates with one
+// memcpy per reallocation; copied_buffer has the same layout but a
+// user-defined copy constructor, so it is copied element by element.
+
+struct buffer
+{
+	int		idx;
+	char	data[4096];
+};
+
+struct copied_buffer
+{
+	int		idx;
+	char	data[4096];
+
+	copied_buffer() : idx(0) {}
+	copied_buffer(const copied_buffer& o) : idx(o.idx) { std::memcpy(data, o.data, sizeof(data)); }
+};
+
+template<class V>
+static double	grow(size_t n, const typename V::value_type& value)
+{
+	double	best = 1e9;
+
+	for (int round = 0; round < 3; ++round)
+	{
+		double	start = ft_bench::now();
+		{
+			V	v;
+			for (size_t i = 0; i < n; ++i)
+				v.push_back(value);
+			ft_bench::keep(v[n / 2]);
+		}
+		best = std::min(best, ft_bench::now() - start);
+	}
+	return best;
+}
+
+template<class T>
+static void	run(const char* name, size_t n, const T& value)
+{
+	double	ours = grow<ft::vector<T> >(n, value);
+	double	theirs = grow<std::vector<T> >(n, value);
+
+	std::printf("%-14s x %8lu: ft::vector %7.1f ms, std::vector %7.1f ms\n",
+		name, (unsigned long)n, ours * 1e3, theirs * 1e3);
+}
+
+int	main()
+{
+	buffer			b;
+	copied_buffer	c;
+
+	std::memset(&b, 1, sizeof(b));
+	std::memset(c.data, 1, sizeof(c.data));
+	run("int", 10000000, 7);
+	run("std::string", 1000000, std::string(40, 'x'));
+	run("buffer", 40000, b);
+	run("copied_buffer", 40000, c);
+	return 0;
+}
@@ -0,0 +1,37 @@
+#include "bench/bench.hpp"
+#include "vector/vector.hpp"
+
+#include <string>
+#include <vector>
+
+// 1000 single-element inserts at scattered positions of a vector of
+// std::string with spare capacity: allocator calls, slots allocated and
+// time per insert, against std::vector with the same allocator.
+
+template<class V>
+static void	run(const char* name, int size)
+{
+	V	v;
+
+	v.reserve(size + 1000);
+	for (int i = 0; i < size; ++i)
+		v.push_back(std::string(24, (char)('a' + i % 26)));
+	ft_bench::alloc_stats::reset();
+	double	start = ft_bench::now();
+	for (int i = 0; i < 1000; ++i)
+		v.insert(v.begin() + (i * 7919) % v.size(), std::string(24, 'z'));
+	double	elapsed = ft_bench::now() - start;
+	std::printf("%-11s n=%6d: %7.2f us, %.1f allocator calls and %.1f slots per insert\n",
+		name, size, elapsed * 1e6 / 1000, ft_bench::alloc_stats::calls / 1000.0,
+		ft_bench::alloc_stats::bytes / sizeof(std::string) / 1000.0);
+}
+
+int	main()
+{
+	for (int size = 1000; size <= 100000; size *= 10)
+	{
+		run<ft::vector<std::string, ft_bench::counting_allocator<std::string> > >("ft::vector", size);
+		run<std::vector<std::string, ft_bench::counting_allocator<std::string> > >("std::vector", size);
+	}
+	return 0;
+}
@@ -0,0 +1,55 @@
+#include "bench/bench.hpp"
+#include "vector/vector.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+// Repeated inserts of a 16 element range, or a fill of 16 copies, at the
+// front, middle or back: 20000 for int, 400 for std::string. Best of 3.
+
+static const char*	places[] = { "front", "middle", "back" };
+
+template<class V>
+static double	insert_ranges(int inserts, int place, bool fill, const typename V::value_type& value)
+{
+	typedef typename V::value_type	T;
+
+	std::vector<T>	src(16, value);
+	double			best = 1e9;
+
+	for (int round = 0; round < 3; ++round)
+	{
+		double	start = ft_bench::now();
+		V		v;
+		for (int i = 0; i < inserts; ++i)
+		{
+			size_t	at = place == 0 ? 0 : place == 1 ? v.size() / 2 : v.size();
+			if (fill)
+				v.insert(v.begin() + at, 16, value);
+			else
+				v.insert(v.begin() + at, src.begin(), src.end());
+		}
+		ft_bench::keep(v[0]);
+		best = std::min(best, ft_bench::now() - start);
+	}
+	return best;
+}
+
+template<class T>
+static void	run(const char* name, int inserts, const T& value)
+{
+	for (int fill = 0; fill < 2; ++fill)
+		for (int place = 0; place < 3; ++place)
+			std::printf("%-11s %-5s at the %-6s: ft::vector %7.1f ms, std::vector %7.1f ms\n",
+				name, fill ? "fill" : "range", places[place],
+				insert_ranges<ft::vector<T> >(inserts, place, fill, value) * 1e3,
+				insert_ranges<std::vector<T> >(inserts, place, fill, value) * 1e3);
+}
+
+int	main()
+{
+	run("int", 20000, 7);
+	run("std::string", 400, std::string(20, 'x'));
+	return 0;
+}
@@ -0,0 +1,128 @@
+/*
+ * ft::concurrent_map<Key, T, Compare, Alloc>
+ * ------------------------------------------
+ * An ordered map that many threads can use at once without an outside lock.
+ *
+ * Template Parameters:
+ *   - Key: Key type.
+ *   - T: Mapped value type.
+ *   - Compare: Key comparison functor (default: std::less<Key>).
+ *   - Alloc: Allocator (default: std::allocator<ft::pair<const Key, T>>).
+ *
+ * Features:
+ *   - Skip list: expected O(log n) find, insert and erase
+ *   - Lock-free readers: find, count, lower_bound, upper_bound and range
+ *     scans never block, not even behind writers
+ *   - Writers are serialized by one internal mutex
+ *   - Epoch-based reclamation: erased nodes are freed once no reader can
+ *     still be looking at them
+ *
+ * Example Usage:
+ *   ft::concurrent_map<int, int> m;        // shared by every thread
+ *   m.insert(ft::make_pair(1, 10));
+ *   int value;
+ *   if (m.find(1, value))
+ *       std::cout << value << std::endl;
+ *   for (ft::concurrent_map<int, int>::const_iterator it = m.lower_bound(0); it != m.end(); ++it)
+ *       std::cout << it->first << std::endl;
+ *
+ * Methods:
+ *   - Constructors: default
+ *   - get_allocator
+ *   - begin, end
+ *   - empty, size
+ *   - insert, insert_or_assign, erase, clear
+ *   - find, count, lower_bound, upper_bound
+ *   - key_comp
+ *
+ * Notes:
+ *   - The map cannot be copied.
+ *   - find copies the mapped value out, since the element may be erased
+ *     right after the call returns.
+ *   - Elements are read-only. insert_or_assign publishes a new element in
+ *     place of the old one.
+ *   - A live iterator holds back reclamation of everything erased after it
+ *     was created, so do not keep iterators around between scans.
+ *   - size() is exact only while no writer is running.
+ */
+#ifndef _CONCURRENT_MAP_HPP_
+#define _CONCURRENT_MAP_HPP_
+
+#include "../tree_utils/skip_list.hpp"
+
+namespace ft
+{
+	template <typename Key,
+			typename T,
+			typename Compare = std::less<Key>,
+			typename Alloc = std::allocator<ft::pair<const Key, T> > >
+	class concurrent_map
+	{
+	public:
+		typedef Key							key_type;
+		typedef T							mapped_type;
+		typedef ft::pair<const Key, T>		value_type;
+		typedef	Compare						key_compare;
+
+	private:
+
+		typedef Concurrent_skip_list<key_type, value_type, Compare, Alloc>		Rep_type;
+
+		Rep_type	list;
+
+		concurrent_map(const concurrent_map&);
+		concurrent_map& operator=(const concurrent_map&);
+
+	public:
+		typedef typename Rep_type::allocator_type           allocator_type;
+		typedef typename Rep_type::const_reference          const_reference;
+		typedef typename Rep_type::const_iterator           const_iterator;
+		typedef typename Rep_type::size_type                size_type;
+
+		//-------Constructors----
+		concurrent_map() : list() {}
+
+		explicit concurrent_map(const Compare& comp, const allocator_type& a = allocator_type()) : list(comp, a) {}
+
+		~concurrent_map() {}
+
+		allocator_type	get_allocator() const { return list.get_allocator(); }
+
+		//-------------| Iterator FUNCTIONS |-------
+
+		const_iterator	begin() const { return list.begin(); }
+
+		const_iterator	end() const { return list.end(); }
+
+
+		bool	empty() const { return list.empty(); }
+
+		size_type	size() const { return list.size(); }
+
+		//returns false if the key was already present
+		bool	insert(const value_type& x) { return list.insert(x); }
+
+		//returns false if an existing value was replaced
+		bool	insert_or_assign(const Key& key, const T& value)
+		{ return list.insert_or_assign(value_type(key, value)); }
+
+		size_type	erase(const Key& key) { return list.erase(key); }
+
+		void	clear() { list.clear(); }
+
+		key_compare	key_comp() const { return list.key_comp(); }
+
+		//copies the value of key to out, returns false if there is none
+		bool	find(const Key& key, T& out) const { return list.find(key, out); }
+
+		size_type	count(const Key& key) const { return list.contains(key) ? 1 : 0; }
+
+		const_iterator	lower_bound(const Key& key) const { return list.lower_bound(key); }
+
+		const_iterator	upper_bound(const Key& key) const { return list.upper_bound(key); }
+
+	}; //concurrent_map
+
+} //namespace ft
+
+#endif
@@ -0,0 +1,275 @@
+/*
+ * ft::cow_map<Key, T, Compare, Alloc>
+ * -----------------------------------
+ * An ordered map with the interface of ft::map whose copies share their
+ * nodes, and whose writes copy only the nodes on one root path.
+ *
+ * Template Parameters:
+ *   - Key: Key type.
+ *   - T: Mapped value type.
+ *   - Compare: Key comparison functor (default: std::less<Key>).
+ *   - Alloc: Allocator (default: std::allocator<ft::pair<const Key, T>>).
+ *
+ * Features:
+ *   - O(1) copy construction and assignment
+ *   - Writes after a copy cost O(log n): insert, erase, operator[] and at
+ *     copy the shared nodes on the path to the key and nothing else
+ *   - Copies can be handed to other threads, the node share counts are atomic
+ *   - Same interface as ft::map, with read-only iterators
+ *
+ * Example Usage:
+ *   ft::cow_map<std::string, int> config;
+ *   config["workers"] = 8;
+ *   ft::cow_map<std::string, int> snapshot = config; // no element is copied
+ *   config["workers"] = 16;                          // copies one path
+ *   std::cout << snapshot.at("workers") << std::endl; // 8
+ *
+ * Methods:
+ *   - Everything ft::map offers, except find_batch
+ *   - shared, use_count
+ *
+ * Notes:
+ *   - Built on the persistent AVL tree of ft::persistent_map: lookups and
+ *     iteration never copy anything, const or not.
+ *   - Iterators are read-only, as in ft::set: values change through
+ *     operator[], at, insert and erase only. Any write invalidates them.
+ *   - A write to a map nobody shares still allocates the O(log n) nodes of
+ *     its path, except operator[] and at on an existing key, which then
+ *     write in place.
+ *   - References from the non-const at() or operator[] are valid until the
+ *     map is next written to or copied.
+ */
+#ifndef _COW_MAP_HPP_
+#define _COW_MAP_HPP_
+
+#include <functional>
+
+#include "../tree_utils/persistent_tree.hpp"
+#include "../utils/reverse_iterator.hpp"
+#include "../utils/algorithm.hpp"
+
+namespace ft
+{
+	template <typename Key,
+			typename T,
+			typename Compare = std::less<Key>,
+			typename Alloc = std::allocator<ft::pair<const Key, T> > >
+	class cow_map
+	{
+	public:
+		typedef Key							key_type;
+		typedef T							mapped_type;
+		typedef ft::pair<const Key, T>		value_type;
+		typedef	Compare						key_compare;
+
+		class value_compare : public std::binary_function<value_type, value_type, bool>
+		{
+			friend class cow_map<Key, T, Compare, Alloc>;
+		protected:
+			Compare	comp;
+
+			value_compare(Compare c) : comp(c) {}
+
+		public:
+			bool	operator()(const value_type& _x, const value_type& _y) const
+			{
+				return comp(_x.first, _y.first);
+			}
+			value_compare() {}
+		};
+
+	private:
+
+		typedef Persistent_map_tree<key_type, value_type, Compare, Alloc>		Rep_type;
+
+		// Version this map shows; copies share its nodes
+		Rep_type	tree;
+
+	public:
+		typedef typename Rep_type::allocator_type           allocator_type;
+		typedef typename Rep_type::reference                reference;
+		typedef typename Rep_type::const_reference          const_reference;
+		typedef typename Rep_type::const_iterator           iterator; // read-only, see Notes
+		typedef typename Rep_type::const_iterator           const_iterator;
+		typedef typename Rep_type::size_type                size_type;
+		typedef typename Rep_type::difference_type          difference_type;
+		typedef typename Rep_type::pointer                  pointer;
+		typedef typename Rep_type::const_pointer            const_pointer;
+		typedef ft::reverse_iterator<const_iterator>        reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>        const_reverse_iterator;
+
+		//-------Constructors----
+		cow_map() : tree() {}
+
+		explicit cow_map(const Compare& comp, const allocator_type& a = allocator_type()) : tree(comp, a) {}
+
+		cow_map(const cow_map& other) : tree(other.tree) {}
+
+		template <typename InputIterator>
+		cow_map(InputIterator first, InputIterator last, const Compare& comp = Compare(), const allocator_type& a = allocator_type())
+		: tree(comp, a)
+		{
+			tree.insert(first, last);
+		}
+
+		//------| assignment operator |--------
+		cow_map&	operator=(const cow_map& other)
+		{
+			tree = other.tree;
+			return *this;
+		}
+
+		~cow_map() {}
+
+		//true while at least one other cow_map shares this map's root
+		bool		shared() const { return use_count() > 1; }
+
+		long		use_count() const { return tree.use_count(); }
+
+		//returns Allocator
+		allocator_type	get_allocator() const { return tree.get_allocator(); }
+
+		//-------------| Iterator FUNCTIONS |-------
+
+		const_iterator	begin() const { return tree.begin(); }
+
+		const_iterator	end() const { return tree.end(); }
+
+		const_reverse_iterator	rbegin() const { return const_reverse_iterator(end()); }
+
+		const_reverse_iterator	rend() const { return const_reverse_iterator(begin()); }
+
+
+		bool	empty() const { return tree.empty(); }
+
+		size_type	size() const { return tree.size(); }
+
+		size_type	max_size() const { return tree.max_size(); }
+
+		mapped_type&	operator[](const key_type& key)
+		{
+			tree.insert(value_type(key, T()));
+			return tree.mutableValue(key)->second;
+		}
+
+		T& at( const Key& key )
+		{
+			if (tree.find(key) == tree.end())
+				throw std::out_of_range("No value with this key");
+			return tree.mutableValue(key)->second;
+		}
+
+		const T& at( const Key& key ) const
+		{
+			const_iterator it = tree.find(key);
+
+			if (it != end())
+				return it->second;
+			throw std::out_of_range("No value with this key");
+		}
+
+		ft::pair<iterator, bool>
+		insert(const value_type& x)
+		{
+			bool inserted = tree.insert(x);
+
+			return ft::make_pair(tree.find(x.first), inserted);
+		}
+
+		//every write copies its own path, so a hint saves nothing
+		iterator
+		insert(iterator pos, const value_type& x)
+		{
+			(void)pos;
+			return insert(x).first;
+		}
+
+		template <typename InputIt>
+		void	insert(InputIt first, InputIt last)
+		{ tree.insert(first, last); }
+
+		//pos dies with the version it points into, so the key is copied first
+		iterator	erase(iterator	pos)
+		{
+			key_type	key = pos->first;
+
+			tree.erase(key);
+			return tree.lower_bound(key);
+		}
+
+		size_type	erase(const Key&	key)
+		{ return tree.erase(key); }
+
+		//erases key by key, O(k log n), from the bounds' keys taken up front
+		iterator	erase (iterator first, iterator last)
+		{
+			if (first == last)
+				return last;
+
+			bool		to_end = last == end();
+			key_type	to = to_end ? first->first : last->first;
+			iterator	it = first;
+
+			while (it != end() && (to_end || tree.key_comp()(it->first, to)))
+			{
+				key_type key = it->first;
+
+				tree.erase(key);
+				it = tree.lower_bound(key);
+			}
+			return it;
+		}
+
+		void	swap(cow_map& other) { tree.swap(other.tree); }
+
+		//drops this map's references; shared nodes live on in the copies
+		void	clear() { tree.clear(); }
+
+		key_compare	key_comp() const { return tree.key_comp(); }
+
+		value_compare	value_comp() const { return value_compare(tree.key_comp()); }
+
+		const_iterator	find(const Key& x) const { return tree.find(x); }
+
+		size_type	count(const Key& x) const { return tree.end() == tree.find(x) ? 0 : 1; }
+
+		const_iterator	lower_bound(const Key& key) const { return tree.lower_bound(key); }
+
+		const_iterator	upper_bound(const Key& key) const { return tree.upper_bound(key); }
+
+		pair<const_iterator, const_iterator>	equal_range(const key_type& x) const
+		{ return tree.equal_range(x); }
+
+	}; //cow_map
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool	operator==(const cow_map<Key, T, Compare, Alloc>& lhs, const cow_map<Key, T, Compare, Alloc>& rhs)
+	{ return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool	operator!=(const cow_map<Key, T, Compare, Alloc>& lhs, const cow_map<Key, T, Compare, Alloc>& rhs)
+	{ return !(lhs == rhs); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool	operator<(const cow_map<Key, T, Compare, Alloc>& lhs, const cow_map<Key, T, Compare, Alloc>& rhs)
+	{ return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool	operator>(const cow_map<Key, T, Compare, Alloc>& lhs, const cow_map<Key, T, Compare, Alloc>& rhs)
+	{ return rhs < lhs; }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool	operator<=(const cow_map<Key, T, Compare, Alloc>& lhs, const cow_map<Key, T, Compare, Alloc>& rhs)
+	{ return !(rhs < lhs); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool	operator>=(const cow_map<Key, T, Compare, Alloc>& lhs, const cow_map<Key, T, Compare, Alloc>& rhs)
+	{ return !(lhs < rhs); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline void	swap(cow_map<Key, T, Compare, Alloc>& lhs, cow_map<Key, T, Compare, Alloc>& rhs)
+	{ lhs.swap(rhs); }
+
+} //namespace ft
+
+#endif
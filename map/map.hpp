@@ -29,14 +29,17 @@
  *   - at, operator[]
  *   - begin, end, rbegin, rend
  *   - empty, size, max_size
- *   - insert, erase, swap, clear
- *   - find, count, lower_bound, upper_bound, equal_range
+ *   - insert, assign_sorted, erase, swap, clear
+ *   - find, find_batch, count, lower_bound, upper_bound, equal_range
  *   - key_comp, value_comp
  *   - Comparison operators
  *
  * Notes:
  *   - operator[] inserts a default value if key is not found.
  *   - Throws std::out_of_range in at() if key is not found.
+ *   - find_batch() interleaves the descents of up to RB_TREE_BATCH_WIDTH keys.
+ *   - assign_sorted() trusts its input: unsorted or duplicate keys break the
+ *     tree.
  */
 #ifndef _MAP_H_
 #define _MAP_H_
@@ -211,6 +214,12 @@ namespace ft
 		void	insert(InputIt first, InputIt last)
 		{ tree.insert(first, last); }
 
+		//Replaces the contents with count values read from first, sorted by key
+		//and unique, building the balanced tree in O(n) without comparisons.
+		template <typename InputIt>
+		void	assign_sorted(InputIt first, size_type count)
+		{ tree.assign_sorted(first, count); }
+
 		//Removes the element at pos.
 		iterator	erase(iterator	pos)
 		{ return tree.erase(pos); }
@@ -240,6 +249,13 @@ namespace ft
 
 		const_iterator	find(const Key& x) const { return tree.find(x); }
 
+		//looks up every key of [first, last) and writes the find() result of each to out
+		template <typename ForwardIt, typename OutputIt>
+		OutputIt	find_batch(ForwardIt first, ForwardIt last, OutputIt out) { return tree.find_batch(first, last, out); }
+
+		template <typename ForwardIt, typename OutputIt>
+		OutputIt	find_batch(ForwardIt first, ForwardIt last, OutputIt out) const { return tree.find_batch(first, last, out); }
+
 		size_type	count(const Key& x) const { return tree.end() == tree.find(x) ? 0 : 1; }
 
 		iterator	lower_bound(const Key& key) { return tree.lower_bound(key); }
@@ -286,18 +302,9 @@ namespace ft
 	{ return !(lhs < rhs); }
 
 	template <typename Key, typename T, typename Compare, typename Alloc>
-	inline void	swap(const map<Key, T, Compare, Alloc>& lhs, const map<Key, T, Compare, Alloc>& rhs)
-	{ lhs.tree.swap(rhs.tree); }
+	inline void	swap(map<Key, T, Compare, Alloc>& lhs, map<Key, T, Compare, Alloc>& rhs)
+	{ lhs.swap(rhs); }
 
 } //namespace ft
 
-namespace std
-{
-	template <class Key, class T, class Compare, class A>
-	void swap(const ft::map<Key, T, Compare, A> &m1, const ft::map<Key, T, Compare, A> &m2 )
-	{
-		m1.swap(m2);
-	}
-}
-
 #endif
\ No newline at end of file
@@ -0,0 +1,210 @@
+/*
+ * ft::persistent_map<Key, T, Compare, Alloc>
+ * ------------------------------------------
+ * An immutable-node ordered map where every copy is a point-in-time snapshot.
+ *
+ * Template Parameters:
+ *   - Key: Key type.
+ *   - T: Mapped value type.
+ *   - Compare: Key comparison functor (default: std::less<Key>).
+ *   - Alloc: Allocator (default: std::allocator<ft::pair<const Key, T>>).
+ *
+ * Features:
+ *   - O(1) snapshots: copying a map shares all of its nodes
+ *   - insert and erase copy only the O(log n) nodes on the root path
+ *   - Snapshots stay valid and readable from other threads while the
+ *     original keeps changing; node share counts are atomic
+ *   - Nodes are freed when the last version referencing them goes away
+ *
+ * Example Usage:
+ *   ft::persistent_map<int, std::string> live;
+ *   live.insert(ft::make_pair(1, std::string("one")));
+ *   ft::persistent_map<int, std::string> snap = live.snapshot();
+ *   live.erase(1);
+ *   std::cout << snap.at(1) << std::endl; // still "one"
+ *
+ * Methods:
+ *   - Constructors: default, range, copy
+ *   - operator=, snapshot, get_allocator
+ *   - at
+ *   - begin, end
+ *   - empty, size, max_size
+ *   - insert, insert_or_assign, erase, swap, clear
+ *   - find, count, lower_bound, upper_bound, equal_range
+ *   - key_comp, value_comp
+ *   - Comparison operators
+ *
+ * Notes:
+ *   - Elements are read-only and iterators are bidirectional, const iterators.
+ *   - A single persistent_map object is not thread-safe; hand each reader
+ *     its own copy (the copy itself must not race with a write to the source).
+ *   - insert returns whether the key was new instead of an iterator.
+ */
+#ifndef _PERSISTENT_MAP_HPP_
+#define _PERSISTENT_MAP_HPP_
+
+#include "../tree_utils/persistent_tree.hpp"
+#include "../utils/algorithm.hpp"
+
+namespace ft
+{
+	template <typename Key,
+			typename T,
+			typename Compare = std::less<Key>,
+			typename Alloc = std::allocator<ft::pair<const Key, T> > >
+	class persistent_map
+	{
+	public:
+		typedef Key							key_type;
+		typedef T							mapped_type;
+		typedef ft::pair<const Key, T>		value_type;
+		typedef	Compare						key_compare;
+
+		class value_compare : public std::binary_function<value_type, value_type, bool>
+		{
+			friend class persistent_map<Key, T, Compare, Alloc>;
+		protected:
+			Compare	comp;
+
+			value_compare(Compare c) : comp(c) {}
+
+		public:
+			bool	operator()(const value_type& _x, const value_type& _y) const
+			{
+				return comp(_x.first, _y.first);
+			}
+			value_compare() {}
+		};
+
+	private:
+
+		typedef Persistent_map_tree<key_type, value_type, Compare, Alloc>		Rep_type;
+
+		// Version this map currently shows
+		Rep_type	tree;
+
+	public:
+		typedef typename Rep_type::allocator_type           allocator_type;
+		typedef typename Rep_type::reference                reference;
+		typedef typename Rep_type::const_reference          const_reference;
+		typedef typename Rep_type::iterator                 iterator;
+		typedef typename Rep_type::const_iterator           const_iterator;
+		typedef typename Rep_type::size_type                size_type;
+		typedef typename Rep_type::difference_type          difference_type;
+		typedef typename Rep_type::pointer                  pointer;
+		typedef typename Rep_type::const_pointer            const_pointer;
+
+		//-------Constructors----
+		persistent_map() : tree() {}
+
+		explicit persistent_map(const Compare& comp, const allocator_type& a = allocator_type()) : tree(comp, a) {}
+
+		persistent_map(const persistent_map& other) : tree(other.tree) {}
+
+		template <typename InputIterator>
+		persistent_map(InputIterator first, InputIterator last, const Compare& comp = Compare(), const allocator_type& a = allocator_type())
+		: tree(comp, a)
+		{
+			tree.insert(first, last);
+		}
+
+		persistent_map&	operator=(const persistent_map& other)
+		{
+			tree = other.tree;
+			return *this;
+		}
+
+		~persistent_map() {}
+
+		//returns a copy sharing every node of the current version
+		persistent_map	snapshot() const { return *this; }
+
+		allocator_type	get_allocator() const { return tree.get_allocator(); }
+
+		//-------------| Iterator FUNCTIONS |-------
+
+		const_iterator	begin() const { return tree.begin(); }
+
+		const_iterator	end() const { return tree.end(); }
+
+
+		bool	empty() const { return tree.empty(); }
+
+		size_type	size() const { return tree.size(); }
+
+		size_type	max_size() const { return tree.max_size(); }
+
+		const T& at( const Key& key ) const
+		{
+			const_iterator it = tree.find(key);
+
+			if (it != end())
+				return it->second;
+			else
+				throw std::out_of_range("No value with this key");
+		}
+
+		//returns false if the key was already present
+		bool	insert(const value_type& x) { return tree.insert(x); }
+
+		//returns false if an existing value was replaced
+		bool	insert_or_assign(const Key& key, const T& value)
+		{ return tree.insert_or_assign(value_type(key, value)); }
+
+		template <typename InputIt>
+		void	insert(InputIt first, InputIt last) { tree.insert(first, last); }
+
+		size_type	erase(const Key& key) { return tree.erase(key); }
+
+		void	swap(persistent_map& other) { tree.swap(other.tree); }
+
+		void	clear() { tree.clear(); }
+
+		key_compare	key_comp() const { return tree.key_comp(); }
+
+		value_compare	value_comp() const { return value_compare(tree.key_comp()); }
+
+		const_iterator	find(const Key& x) const { return tree.find(x); }
+
+		size_type	count(const Key& x) const { return tree.end() == tree.find(x) ? 0 : 1; }
+
+		const_iterator	lower_bound(const Key& key) const { return tree.lower_bound(key); }
+
+		const_iterator	upper_bound(const Key& key) const { return tree.upper_bound(key); }
+
+		pair<const_iterator, const_iterator>	equal_range(const key_type& x) const
+		{ return tree.equal_range(x); }
+
+	}; //persistent_map
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool	operator==(const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs)
+	{ return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool	operator!=(const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs)
+	{ return !(lhs == rhs); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool	operator<(const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs)
+	{ return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool	operator>(const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs)
+	{ return rhs < lhs; }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool	operator<=(const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs)
+	{ return !(rhs < lhs); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline bool	operator>=(const persistent_map<Key, T, Compare, Alloc>& lhs, const persistent_map<Key, T, Compare, Alloc>& rhs)
+	{ return !(lhs < rhs); }
+
+	template <typename Key, typename T, typename Compare, typename Alloc>
+	inline void	swap(persistent_map<Key, T, Compare, Alloc>& lhs, persistent_map<Key, T, Compare, Alloc>& rhs)
+	{ lhs.swap(rhs); }
+
+} //namespace ft
+
+#endif
@@ -28,13 +28,15 @@
  *   - operator=, get_allocator
  *   - begin, end, rbegin, rend
  *   - empty, size, max_size
- *   - insert, erase, swap, clear
- *   - find, count, lower_bound, upper_bound, equal_range
+ *   - insert, assign_sorted, erase, swap, clear
+ *   - find, find_batch, count, lower_bound, upper_bound, equal_range
  *   - key_comp, value_comp
  *   - Comparison operators
  *
  * Notes:
  *   - All elements are unique and sorted by key.
+ *   - assign_sorted() trusts its input: unsorted or duplicate keys break the
+ *     tree.
  */
 //
 // Created by Kerim Sancakoglu on 2/2/23.
@@ -130,6 +132,12 @@ namespace ft
 		iterator insert(iterator pos, const value_type &val)
 		{ return tree.insert(pos, val); }
 
+		//Replaces the contents with count sorted, unique keys read from first,
+		//building the balanced tree in O(n) without comparisons.
+		template<class InputIt>
+		void assign_sorted(InputIt first, size_type count)
+		{ tree.assign_sorted(first, count); }
+
 
 
 		iterator erase(iterator pos )
@@ -157,6 +165,16 @@ namespace ft
 		{ return tree.find(key); }
 
 
+		//looks up every key of [first, last) and writes the find() result of each to out
+		template<class ForwardIt, class OutputIt>
+		OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+		{ return tree.find_batch(first, last, out); }
+
+		template<class ForwardIt, class OutputIt>
+		OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+		{ return tree.find_batch(first, last, out); }
+
+
 		ft::pair<const_iterator, const_iterator> equal_range(const key_type& key) const
 		{
 			ft::pair<iterator, iterator> duo = tree.equal_range(key);
@@ -244,8 +262,6 @@ namespace ft
 		}
 	};
 
-	//std::swap specializes
-
 	template <typename Key, typename Compare, typename Alloc>
 	inline bool	operator==(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs)
 	{ return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
@@ -271,16 +287,8 @@ namespace ft
 	{ return !(lhs < rhs); }
 
 	template <typename Key, typename Compare, typename Alloc>
-	inline bool	swap(const set<Key, Compare, Alloc>& lhs, const set<Key, Compare, Alloc>& rhs)
-	{ lhs.tree.swap(rhs.tree); }
-}
-
-
-namespace std
-{
-	template <typename Key, typename Compare, typename Alloc>
-	void swap(const ft::set<Key, Compare, Alloc>& lhs, const ft::set<Key, Compare, Alloc>& rhs)
-	{ lhs.tree.swap(rhs.tree); }
+	inline void	swap(set<Key, Compare, Alloc>& lhs, set<Key, Compare, Alloc>& rhs)
+	{ lhs.swap(rhs); }
 }
 
 #endif
@@ -0,0 +1,53 @@
+#ifndef FT_TESTS_CHECK_HPP
+#define FT_TESTS_CHECK_HPP
+
+/*
+ * Shared helpers for the randomized checks in tests/. Each *_test.cpp is
+ * its own program: `make test` builds them all and stops at the first one
+ * that exits non-zero. CHECK stays on under NDEBUG, unlike assert.
+ */
+
+#include <cstdio>
+#include <cstdlib>
+
+#define CHECK(cond) ((cond) ? (void)0 : ft_test::fail(#cond, __FILE__, __LINE__))
+
+namespace ft_test
+{
+	inline void	fail(const char* what, const char* file, int line)
+	{
+		std::fprintf(stderr, "%s:%d: check failed: %s\n", file, line, what);
+		std::exit(1);
+	}
+
+	// Deterministic LCG so a failing run can be replayed with the same seed.
+	struct rng
+	{
+		unsigned long	state;
+
+		explicit rng(unsigned long seed = 42) : state(seed) {}
+
+		unsigned long	operator()()
+		{
+			state = state * 6364136223846793005UL + 1442695040888963407UL;
+			return state >> 33;
+		}
+
+		unsigned long	operator()(unsigned long bound) { return (*this)() % bound; }
+	};
+
+	template<class A, class B>
+	bool	same(const A& a, const B& b)
+	{
+		if (a.size() != b.size())
+			return false;
+		typename A::const_iterator	i = a.begin();
+		typename B::const_iterator	j = b.begin();
+		for (; i != a.end(); ++i, ++j)
+			if (!(*i == *j))
+				return false;
+		return true;
+	}
+}
+
+#endif
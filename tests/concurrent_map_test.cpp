@@ -0,0 +1,171 @@
+#include "tests/check.hpp"
+#include "map/concurrent_map.hpp"
+
+#include <pthread.h>
+#include <map>
+#include <stdexcept>
+#include <vector>
+
+typedef ft::concurrent_map<int, long>	concurrent;
+
+static void	test_against_std()
+{
+	ft_test::rng		rng;
+	concurrent			m;
+	std::map<int, long>	r;
+
+	for (int op = 0; op < 50000; ++op)
+	{
+		int	k = rng(1000);
+		switch (rng(3))
+		{
+			case 0:
+				CHECK(m.insert(ft::make_pair(k, (long)op)) == r.insert(std::make_pair(k, (long)op)).second);
+				break;
+			case 1:
+				CHECK(m.erase(k) == r.erase(k));
+				break;
+			default:
+				CHECK(m.insert_or_assign(k, op) == !r.count(k));
+				r[k] = op;
+		}
+		long	v;
+		CHECK(m.find(k, v) == (r.count(k) == 1));
+		CHECK(!r.count(k) || v == r[k]);
+	}
+	CHECK(m.size() == r.size());
+	std::map<int, long>::iterator	j = r.begin();
+	for (concurrent::const_iterator i = m.begin(); i != m.end(); ++i, ++j)
+		CHECK(i->first == j->first && i->second == j->second);
+	for (int k = -1; k < 1002; k += 7)
+	{
+		concurrent::const_iterator		u = m.upper_bound(k);
+		std::map<int, long>::iterator	v = r.upper_bound(k);
+		CHECK((u == m.end()) == (v == r.end()));
+		CHECK(u == m.end() || u->first == v->first);
+	}
+	m.clear();
+	CHECK(m.empty() && m.begin() == m.end());
+}
+
+static concurrent		shared;
+static ft::atomic<int>	stop(0);
+
+// Every value is three times its key, whatever the writers are doing.
+static void*	read_ranges(void*)
+{
+	ft_test::rng	rng(12345);
+
+	while (!stop.load())
+	{
+		int		k = rng(10000);
+		long	v;
+		if (shared.find(k, v))
+			CHECK(v == k * 3L);
+		int	prev = -1;
+		int	n = 0;
+		for (concurrent::const_iterator i = shared.lower_bound(k); i != shared.end() && n < 50; ++i, ++n)
+		{
+			CHECK(i->first > prev && i->second == i->first * 3L);
+			prev = i->first;
+		}
+	}
+	return 0;
+}
+
+static void*	write_keys(void* seed)
+{
+	ft_test::rng	rng((unsigned long)seed);
+
+	for (int i = 0; i < 50000; ++i)
+	{
+		int	k = rng(10000);
+		switch (rng(3))
+		{
+			case 0:
+				shared.insert(ft::make_pair(k, k * 3L));
+				break;
+			case 1:
+				shared.erase(k);
+				break;
+			default:
+				shared.insert_or_assign(k, k * 3L);
+		}
+	}
+	return 0;
+}
+
+static void	test_readers_during_writes()
+{
+	pthread_t	t[8];
+
+	for (long i = 0; i < 4; ++i)
+		pthread_create(&t[i], 0, read_ranges, 0);
+	for (long i = 4; i < 8; ++i)
+		pthread_create(&t[i], 0, write_keys, (void*)(i * 77));
+	for (int i = 4; i < 8; ++i)
+		pthread_join(t[i], 0);
+	stop.store(1);
+	for (int i = 0; i < 4; ++i)
+		pthread_join(t[i], 0);
+	shared.clear();
+}
+
+// An iterator, or a copy of one, keeps its node alive after an erase.
+static void	test_pinned_iterators()
+{
+	ft::concurrent_map<int, int>	m;
+	for (int i = 0; i < 4; ++i)
+		m.insert(ft::make_pair(i, i * 10));
+
+	ft::concurrent_map<int, int>::const_iterator*	it = new ft::concurrent_map<int, int>::const_iterator(m.lower_bound(2));
+	m.erase(2);
+	ft::concurrent_map<int, int>::const_iterator	copy = *it;
+	delete it;
+	m.erase(1);
+	m.erase(3);
+	m.erase(0);
+	m.insert(ft::make_pair(7, 7));
+	m.erase(7);
+	CHECK(copy->first == 2 && copy->second == 20);
+
+	ft::concurrent_map<int, int>	big;
+	for (int i = 0; i < 200000; ++i)
+		big.insert(ft::make_pair(i, i));
+	ft::concurrent_map<int, int>::const_iterator	pin = big.begin();
+	big.clear();
+	CHECK(pin->first == 0);
+	++pin;
+	CHECK(pin->first == 1);
+}
+
+static void	test_reader_slots_run_out()
+{
+	ft::concurrent_map<int, int>								m;
+	std::vector<ft::concurrent_map<int, int>::const_iterator>	held;
+	bool														thrown = false;
+
+	m.insert(ft::make_pair(1, 1));
+	held.reserve(EPOCH_DOMAIN_SLOTS + 1);
+	try
+	{
+		for (int i = 0; i <= EPOCH_DOMAIN_SLOTS; ++i)
+			held.push_back(m.begin());
+	}
+	catch (std::length_error&)
+	{
+		thrown = true;
+	}
+	CHECK(thrown && held.size() == EPOCH_DOMAIN_SLOTS - 1);
+	held.clear();
+	CHECK(m.begin()->first == 1);
+}
+
+int	main()
+{
+	test_against_std();
+	test_readers_during_writes();
+	test_pinned_iterators();
+	test_reader_slots_run_out();
+	return 0;
+}
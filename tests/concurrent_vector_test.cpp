@@ -0,0 +1,171 @@
+#include "tests/check.hpp"
+#include "vector/concurrent_vector.hpp"
+
+#include <pthread.h>
+#include <cstdio>
+#include <string>
+#include <vector>
+#include <stdexcept>
+
+static const int	PRODUCERS = 8;
+static const int	PER_PRODUCER = 20000;
+
+typedef ft::concurrent_vector<std::string>	string_vector;
+
+static string_vector*	shared;
+static ft::atomic<int>	finished(0);
+
+static void*	produce(void* arg)
+{
+	long	id = (long)arg;
+	char	buf[64];
+
+	for (int i = 0; i < PER_PRODUCER; ++i)
+	{
+		std::sprintf(buf, "%ld-%d-padding-to-defeat-sso", id, i);
+		size_t	at = shared->push_back(buf);
+		CHECK((*shared)[at] == buf);
+	}
+	finished.fetch_add(1);
+	return 0;
+}
+
+// Reads the tail while producers run; only published slots may be touched.
+static void*	read_tail(void*)
+{
+	while (finished.load() < PRODUCERS)
+	{
+		size_t	n = shared->size();
+		for (size_t i = n > 100 ? n - 100 : 0; i < n; ++i)
+			if (shared->published(i))
+				CHECK(shared->at(i).size() > 10);
+	}
+	return 0;
+}
+
+static void	test_concurrent_push_back()
+{
+	string_vector	v;
+	pthread_t		t[PRODUCERS + 1];
+
+	shared = &v;
+	for (long i = 0; i < PRODUCERS; ++i)
+		pthread_create(&t[i], 0, produce, (void*)i);
+	pthread_create(&t[PRODUCERS], 0, read_tail, 0);
+	for (int i = 0; i <= PRODUCERS; ++i)
+		pthread_join(t[i], 0);
+
+	CHECK(v.size() == (size_t)PRODUCERS * PER_PRODUCER);
+	std::vector<int>	seen(PRODUCERS * PER_PRODUCER, 0);
+	for (string_vector::const_iterator it = v.begin(); it != v.end(); ++it)
+	{
+		long	id;
+		int		i;
+		CHECK(std::sscanf(it->c_str(), "%ld-%d", &id, &i) == 2);
+		++seen[id * PER_PRODUCER + i];
+	}
+	for (size_t i = 0; i < seen.size(); ++i)
+		CHECK(seen[i] == 1);
+	CHECK(!v.published(v.size()));
+	try
+	{
+		v.at(v.size() + 10);
+		CHECK(!"at() past the end did not throw");
+	}
+	catch (std::out_of_range&) {}
+	v.clear();
+	CHECK(v.empty());
+	v.push_back("a");
+	CHECK(v[0] == "a" && v.published(0));
+}
+
+static ft::atomic<long>	bytes_allocated(0);
+static ft::atomic<int>	fail_next(0);
+
+template<class T>
+struct failing_allocator : std::allocator<T>
+{
+	template<class U>
+	struct rebind { typedef failing_allocator<U> other; };
+
+	failing_allocator() {}
+	template<class U>
+	failing_allocator(const failing_allocator<U>&) {}
+
+	T*	allocate(size_t n, const void* = 0)
+	{
+		if (fail_next.load() > 0)
+		{
+			fail_next.fetch_sub(1);
+			throw std::bad_alloc();
+		}
+		bytes_allocated.fetch_add(n * sizeof(T));
+		return std::allocator<T>::allocate(n);
+	}
+};
+
+typedef ft::concurrent_vector<int, failing_allocator<int> >	int_vector;
+
+static int_vector*	shared_ints;
+
+static void*	produce_ints(void*)
+{
+	for (int i = 0; i < 200000; ++i)
+		shared_ints->push_back(i);
+	return 0;
+}
+
+// Racing producers must allocate every segment exactly once.
+static void	test_segments_allocated_once()
+{
+	int_vector	v;
+	pthread_t	t[PRODUCERS];
+
+	shared_ints = &v;
+	for (int i = 0; i < PRODUCERS; ++i)
+		pthread_create(&t[i], 0, produce_ints, 0);
+	for (int i = 0; i < PRODUCERS; ++i)
+		pthread_join(t[i], 0);
+
+	CHECK(v.size() == (size_t)PRODUCERS * 200000);
+	long	sum = 0;
+	for (size_t i = 0; i < v.size(); ++i)
+	{
+		CHECK(v.published(i));
+		sum += v[i];
+	}
+	CHECK(sum == PRODUCERS * (199999L * 200000 / 2));
+	long	need = 0;
+	for (size_t k = 0, n = 0; n < v.size(); ++k)
+	{
+		need += (64L << k) * (sizeof(int) + 1);
+		n += 64L << k;
+	}
+	CHECK(bytes_allocated.load() == need);
+}
+
+static void	test_failed_segment_allocation()
+{
+	int_vector	v;
+
+	for (int i = 0; i < 64; ++i)
+		CHECK(v.push_back(i) == (size_t)i);
+	fail_next.store(1);
+	try
+	{
+		v.push_back(64);
+		CHECK(!"push_back did not rethrow bad_alloc");
+	}
+	catch (std::bad_alloc&) {}
+	CHECK(!v.published(64));
+	v.push_back(65);
+	CHECK(v.published(65) && v[65] == 65 && v[0] == 0);
+}
+
+int	main()
+{
+	test_concurrent_push_back();
+	test_segments_allocated_once();
+	test_failed_segment_allocation();
+	return 0;
+}
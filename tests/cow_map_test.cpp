@@ -0,0 +1,135 @@
+#include "tests/check.hpp"
+#include "map/cow_map.hpp"
+
+#include <cstdio>
+#include <map>
+#include <string>
+#include <vector>
+
+typedef ft::cow_map<int, std::string>	cow;
+typedef std::map<int, std::string>		reference;
+
+static void	check_same(const cow& c, const reference& r)
+{
+	CHECK(c.size() == r.size());
+	reference::const_iterator	j = r.begin();
+	for (cow::const_iterator i = c.begin(); i != c.end(); ++i, ++j)
+		CHECK(i->first == j->first && i->second == j->second);
+	reference::const_reverse_iterator	rj = r.rbegin();
+	for (cow::const_reverse_iterator i = c.rbegin(); i != c.rend(); ++i, ++rj)
+		CHECK(i->first == rj->first && i->second == rj->second);
+	if (!r.empty())
+	{
+		cow::const_iterator	last = c.end();
+		--last;
+		CHECK(last->first == r.rbegin()->first);
+	}
+}
+
+// Random writes against std::map, keeping up to 20 older copies that must
+// not see any of the writes made after them.
+static void	test_against_std()
+{
+	ft_test::rng			rng(7);
+	cow						c;
+	reference				r;
+	std::vector<cow>		copies;
+	std::vector<reference>	expected;
+	char					buf[32];
+
+	for (int op = 0; op < 30000; ++op)
+	{
+		int	k = rng(500);
+		std::sprintf(buf, "v%d", op);
+		switch (rng(7))
+		{
+			case 0:
+				c[k] = buf;
+				r[k] = buf;
+				break;
+			case 1:
+			{
+				ft::pair<cow::iterator, bool>	p = c.insert(ft::make_pair(k, std::string(buf)));
+				CHECK(p.second == r.insert(std::make_pair(k, std::string(buf))).second);
+				CHECK(p.first->first == k);
+				break;
+			}
+			case 2:
+				CHECK(c.erase(k) == r.erase(k));
+				break;
+			case 3:
+			{
+				reference::iterator	j = r.lower_bound(k);
+				if (j == r.end())
+					break;
+				cow::iterator	next = c.erase(c.lower_bound(k));
+				r.erase(j++);
+				CHECK((next == c.end()) == (j == r.end()));
+				if (j != r.end())
+					CHECK(next->first == j->first);
+				break;
+			}
+			case 4:
+			{
+				int	last = k + (int)rng(60);
+				c.erase(c.lower_bound(k), c.lower_bound(last));
+				r.erase(r.lower_bound(k), r.lower_bound(last));
+				break;
+			}
+			case 5:
+				if (r.count(k))
+				{
+					c.at(k) += "!";
+					r[k] += "!";
+				}
+				else
+				{
+					try
+					{
+						c.at(k);
+						CHECK(!"at() on a missing key did not throw");
+					}
+					catch (std::out_of_range&) {}
+				}
+				break;
+			default:
+				copies.push_back(c);
+				expected.push_back(r);
+				if (copies.size() > 20)
+				{
+					copies.erase(copies.begin());
+					expected.erase(expected.begin());
+				}
+		}
+		if (op % 1000 == 0)
+		{
+			check_same(c, r);
+			for (size_t i = 0; i < copies.size(); ++i)
+				check_same(copies[i], expected[i]);
+		}
+	}
+	check_same(c, r);
+	for (size_t i = 0; i < copies.size(); ++i)
+		check_same(copies[i], expected[i]);
+}
+
+static void	test_sharing()
+{
+	cow	x;
+	x[1] = "a";
+	cow	y = x;
+	CHECK(x.shared() && y.use_count() == 2);
+	x[1] = "b";
+	CHECK(y.at(1) == "a" && x.at(1) == "b" && !y.shared());
+
+	cow	z = x;
+	x.clear();
+	CHECK(z.size() == 1 && z.at(1) == "b" && x.empty());
+}
+
+int	main()
+{
+	test_against_std();
+	test_sharing();
+	return 0;
+}
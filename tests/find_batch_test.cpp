@@ -0,0 +1,105 @@
+#include "tests/check.hpp"
+#include "map/map.hpp"
+#include "set/set.hpp"
+
+#include <cstdio>
+#include <map>
+#include <set>
+#include <string>
+#include <vector>
+
+// Yields each key as a temporary, so find_batch must not keep &*first.
+struct key_iterator
+{
+	int	i;
+
+	explicit key_iterator(int n) : i(n) {}
+	std::string		operator*() const
+	{
+		char	buf[16];
+		std::sprintf(buf, "k%05d", i);
+		return buf;
+	}
+	key_iterator&	operator++() { ++i; return *this; }
+	bool			operator!=(const key_iterator& o) const { return i != o.i; }
+};
+
+static void	test_against_std()
+{
+	ft_test::rng			rng;
+	ft::map<int, int>		m;
+	ft::set<int>			s;
+	std::map<int, int>		ref;
+
+	for (int i = 0; i < 20000; ++i)
+	{
+		int	k = rng(40000);
+		m.insert(ft::make_pair(k, i));
+		s.insert(k);
+		ref.insert(std::make_pair(k, i));
+	}
+	// Batch sizes that do and do not divide RB_TREE_BATCH_WIDTH.
+	for (size_t n = 0; n < 70; n += 7)
+	{
+		std::vector<int>	keys;
+		for (size_t i = 0; i < n * 50 + 1; ++i)
+			keys.push_back(rng(40000));
+
+		std::vector<ft::map<int, int>::iterator>	hits(keys.size());
+		m.find_batch(keys.begin(), keys.end(), hits.begin());
+		const ft::set<int>&	cs = s;
+		std::vector<ft::set<int>::const_iterator>	set_hits(keys.size());
+		cs.find_batch(keys.begin(), keys.end(), set_hits.begin());
+
+		for (size_t i = 0; i < keys.size(); ++i)
+		{
+			std::map<int, int>::iterator	r = ref.find(keys[i]);
+			CHECK(hits[i] == m.find(keys[i]));
+			CHECK(set_hits[i] == cs.find(keys[i]));
+			CHECK((hits[i] == m.end()) == (r == ref.end()));
+			if (r != ref.end())
+				CHECK(hits[i]->second == r->second);
+		}
+	}
+
+	ft::map<int, int>							empty;
+	std::vector<int>							keys(5, 1);
+	std::vector<ft::map<int, int>::iterator>	hits(keys.size());
+	empty.find_batch(keys.begin(), keys.end(), hits.begin());
+	for (size_t i = 0; i < hits.size(); ++i)
+		CHECK(hits[i] == empty.end());
+}
+
+static void	test_temporary_keys()
+{
+	ft::map<std::string, int>	m;
+	ft::set<std::string>		s;
+
+	for (int i = 0; i < 1000; i += 2)
+	{
+		m[*key_iterator(i)] = i;
+		s.insert(*key_iterator(i));
+	}
+	std::vector<ft::map<std::string, int>::iterator>	hits(1000);
+	m.find_batch(key_iterator(0), key_iterator(1000), hits.begin());
+	for (int i = 0; i < 1000; ++i)
+		CHECK(i % 2 ? hits[i] == m.end() : hits[i]->second == i);
+
+	const ft::map<std::string, int>&							cm = m;
+	std::vector<ft::map<std::string, int>::const_iterator>	const_hits(1000);
+	cm.find_batch(key_iterator(0), key_iterator(1000), const_hits.begin());
+	for (int i = 0; i < 1000; ++i)
+		CHECK(i % 2 ? const_hits[i] == cm.end() : const_hits[i]->second == i);
+
+	std::vector<ft::set<std::string>::iterator>	set_hits(1000);
+	s.find_batch(key_iterator(0), key_iterator(1000), set_hits.begin());
+	for (int i = 0; i < 1000; ++i)
+		CHECK((set_hits[i] == s.end()) == (i % 2 == 1));
+}
+
+int	main()
+{
+	test_against_std();
+	test_temporary_keys();
+	return 0;
+}
@@ -0,0 +1,115 @@
+#include "tests/check.hpp"
+#include "utils/growth_policy.hpp"
+#include "vector/vector.hpp"
+
+#include <string>
+#include <vector>
+
+// Every policy must grow to at least what was asked for, from any start.
+template<class G>
+static void	check_grow()
+{
+	ft_test::rng	rng;
+
+	for (int i = 0; i < 100000; ++i)
+	{
+		size_t	capacity = rng(1 << 20);
+		size_t	required = capacity + 1 + rng(1 << 12);
+		size_t	elem = 1 + rng(64);
+		CHECK(G::grow(capacity, required, elem) >= required);
+		CHECK(G::grow(0, 1, elem) >= 1);
+	}
+}
+
+// Random push_back, insert, resize and assign: only the capacity may
+// differ between policies.
+template<class G>
+static void	check_vector()
+{
+	typedef ft::vector<std::string, std::allocator<std::string>, G>	vector;
+
+	ft_test::rng				rng(5);
+	vector						v;
+	std::vector<std::string>	r;
+
+	for (int op = 0; op < 5000; ++op)
+	{
+		std::string	s(1 + rng(30), (char)('a' + op % 26));
+		switch (rng(6))
+		{
+			case 0:
+			{
+				size_t	at = rng(r.size() + 1);
+				size_t	n = rng(20);
+				v.insert(v.begin() + at, n, s);
+				r.insert(r.begin() + at, n, s);
+				break;
+			}
+			case 1:
+			{
+				size_t	n = rng(r.size() + 20);
+				v.resize(n, s);
+				r.resize(n, s);
+				break;
+			}
+			case 2:
+				if (!rng(20))
+				{
+					size_t	n = rng(100);
+					v.assign(n, s);
+					r.assign(n, s);
+				}
+				break;
+			default:
+				v.push_back(s);
+				r.push_back(s);
+		}
+		CHECK(v.capacity() >= v.size());
+	}
+	CHECK(ft_test::same(v, r));
+}
+
+// Shrinks to twice the size once below a quarter, never on every call.
+static void	test_hysteresis()
+{
+	ft::vector<int, std::allocator<int>, ft::shrink_hysteresis<> >	v;
+	int																reallocs = 0;
+
+	for (int i = 0; i < 1024; ++i)
+		v.push_back(i);
+	CHECK(v.capacity() == 1024);
+	while (v.size() > 255)
+		v.pop_back();
+	CHECK(v.capacity() == 510);
+	size_t	capacity = v.capacity();
+	for (int i = 0; i < 100000; ++i)
+	{
+		if (i % 2)
+			v.pop_back();
+		else
+			v.push_back(i);
+		if (v.capacity() != capacity)
+		{
+			++reallocs;
+			capacity = v.capacity();
+		}
+	}
+	CHECK(reallocs == 0);
+	for (int i = 0; i < 255; ++i)
+		CHECK(v[i] == i);
+}
+
+int	main()
+{
+	check_grow<ft::growth_double>();
+	check_grow<ft::growth_golden>();
+	check_grow<ft::growth_size_class>();
+	check_grow<ft::growth_page_aligned>();
+	check_vector<ft::growth_double>();
+	check_vector<ft::growth_golden>();
+	check_vector<ft::growth_size_class>();
+	check_vector<ft::growth_page_aligned>();
+	check_vector<ft::shrink_hysteresis<ft::growth_golden, 1, 3> >();
+	test_hysteresis();
+	return 0;
+}
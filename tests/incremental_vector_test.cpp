@@ -0,0 +1,169 @@
+#include "tests/check.hpp"
+#include "vector/incremental_vector.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+static int	live = 0;
+static int	budget = -1;
+
+// Counts live objects; copies throw once the budget runs out.
+struct counted
+{
+	int	v;
+
+	counted(int v = 0) : v(v) { ++live; }
+	counted(const counted& o) : v(o.v)
+	{
+		if (budget == 0)
+			throw 1;
+		if (budget > 0)
+			--budget;
+		++live;
+	}
+	~counted() { --live; }
+	bool	operator==(const counted& o) const { return v == o.v; }
+	bool	operator!=(const counted& o) const { return v != o.v; }
+	bool	operator<(const counted& o) const { return v < o.v; }
+};
+
+static void	test_int()
+{
+	ft::incremental_vector<int>	v;
+	for (int i = 0; i < 100000; ++i)
+	{
+		v.push_back(i);
+		CHECK(v[i] == i && v[i / 2] == i / 2);
+	}
+	int	expected = 99999;
+	for (ft::incremental_vector<int>::reverse_iterator it = v.rbegin(); it != v.rend(); ++it)
+		CHECK(*it == expected--);
+	std::sort(v.begin(), v.end());
+
+	ft::incremental_vector<int>	w(v);
+	CHECK(w == v && !w.migrating());
+	v.push_back(v[0]);
+	CHECK(v.back() == 0);
+	v.reserve(1 << 20);
+	CHECK(v.migrating() && v[5] == 5);
+	while (v.size() > 3)
+		v.pop_back();
+	CHECK(v.migrating() && v[2] == 2);
+	w = v;
+	CHECK(w.size() == 3);
+	int*	d = v.data();
+	CHECK(d[1] == 1 && !v.migrating());
+}
+
+// A push_back whose migration step throws is undone, and nothing leaks.
+static void	test_throwing_migration()
+{
+	{
+		ft::incremental_vector<counted>	v;
+		for (int i = 0; i < 1000; ++i)
+			v.push_back(counted(i));
+		while (v.size() != v.capacity())
+			v.push_back(counted(1));
+		size_t	n = v.size();
+		v.push_back(v[3]);
+		CHECK(v.migrating() && v.back().v == 3);
+
+		budget = 1;
+		try
+		{
+			v.push_back(counted(9));
+			CHECK(false);
+		}
+		catch (int)
+		{
+		}
+		budget = -1;
+		CHECK(v.size() == n + 1 && v.back().v == 3);
+
+		ft::incremental_vector<counted>	c(v);
+		CHECK(c == v);
+		v.resize(10);
+		v.resize(20, counted(4));
+		CHECK(v[19].v == 4 && v[9].v == 9);
+		ft::incremental_vector<counted>	s(5, counted(2));
+		swap(s, v);
+		CHECK(v.size() == 5);
+	}
+	CHECK(live == 0);
+}
+
+// Random operations against std::vector, with a step of 1 and golden
+// growth so migrations are long and overlap everything else.
+static void	test_random()
+{
+	typedef ft::incremental_vector<std::string, std::allocator<std::string>, ft::growth_golden, 1>	vector;
+	ft_test::rng				rng(17);
+	vector						v;
+	std::vector<std::string>	r;
+
+	for (int step = 0; step < 50000; ++step)
+	{
+		std::string	value(1 + rng(30), 'a' + rng(26));
+		switch (rng(r.empty() ? 1 : 8))
+		{
+			case 0:
+			case 1:
+			case 2:
+				v.push_back(value);
+				r.push_back(value);
+				break;
+			case 3:
+				v.pop_back();
+				r.pop_back();
+				break;
+			case 4:
+			{
+				size_t	i = rng(r.size());
+				v[i] = value;
+				r[i] = value;
+				break;
+			}
+			case 5:
+				if (rng(20) == 0)
+				{
+					size_t	n = rng(2 * r.size() + 2);
+					v.resize(n, value);
+					r.resize(n, value);
+				}
+				break;
+			case 6:
+				if (rng(50) == 0)
+				{
+					vector	copy(v);
+					v = copy;
+				}
+				break;
+			default:
+				if (rng(100) == 0)
+					v.reserve(v.capacity() + rng(100));
+		}
+		CHECK(v.size() == r.size());
+		if (!r.empty())
+		{
+			size_t	i = rng(r.size());
+			CHECK(v[i] == r[i] && v.back() == r.back());
+		}
+		if (step % 97 == 0)
+			CHECK(ft_test::same(v, r));
+	}
+	CHECK(ft_test::same(v, r));
+	CHECK(v.data() == &v[0] && !v.migrating());
+}
+
+int	main()
+{
+	test_int();
+	test_throwing_migration();
+	test_random();
+
+	std::string						arr[] = { "x", "y" };
+	ft::incremental_vector<std::string>	r(arr, arr + 2);
+	CHECK(r.at(1) == "y");
+	return 0;
+}
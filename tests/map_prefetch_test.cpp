@@ -0,0 +1,113 @@
+// The prefetching descents and increments must not change any result.
+#define RB_TREE_PREFETCH
+
+#include "tests/check.hpp"
+#include "map/map.hpp"
+#include "set/set.hpp"
+
+#include <map>
+#include <set>
+
+static void	test_map_against_std()
+{
+	ft_test::rng		rng;
+	ft::map<int, int>	m;
+	std::map<int, int>	ref;
+
+	for (int op = 0; op < 200000; ++op)
+	{
+		int	k = rng(5000);
+		switch (rng(7))
+		{
+			case 0:
+			case 1:
+				CHECK(m.insert(ft::make_pair(k, op)).second == ref.insert(std::make_pair(k, op)).second);
+				break;
+			case 2:
+				CHECK(m.erase(k) == ref.erase(k));
+				break;
+			case 3:
+			{
+				ft::map<int, int>::iterator		i = m.find(k);
+				std::map<int, int>::iterator	j = ref.find(k);
+				CHECK((i == m.end()) == (j == ref.end()));
+				if (j != ref.end())
+					CHECK(i->second == j->second);
+				break;
+			}
+			case 4:
+			{
+				ft::map<int, int>::iterator		i = m.lower_bound(k);
+				std::map<int, int>::iterator	j = ref.lower_bound(k);
+				CHECK((i == m.end()) == (j == ref.end()));
+				if (j != ref.end())
+					CHECK(i->first == j->first);
+				break;
+			}
+			case 5:
+			{
+				int	last = k + (int)rng(50);
+				m.erase(m.lower_bound(k), m.lower_bound(last));
+				ref.erase(ref.lower_bound(k), ref.lower_bound(last));
+				CHECK(m.size() == ref.size());
+				break;
+			}
+			default:
+			{
+				ft::map<int, int>::iterator		i = m.upper_bound(k);
+				std::map<int, int>::iterator	j = ref.upper_bound(k);
+				CHECK((i == m.end()) == (j == ref.end()));
+				if (j != ref.end())
+					CHECK(i->first == j->first);
+			}
+		}
+		if (op % 10000 == 0)
+		{
+			CHECK(m.size() == ref.size());
+			std::map<int, int>::reverse_iterator	j = ref.rbegin();
+			for (ft::map<int, int>::reverse_iterator i = m.rbegin(); i != m.rend(); ++i, ++j)
+				CHECK(i->first == j->first && i->second == j->second);
+		}
+	}
+	CHECK(m.size() == ref.size());
+	std::map<int, int>::iterator	j = ref.begin();
+	for (ft::map<int, int>::iterator i = m.begin(); i != m.end(); ++i, ++j)
+		CHECK(i->first == j->first && i->second == j->second);
+}
+
+static void	test_set_against_std()
+{
+	ft_test::rng	rng(7);
+	ft::set<int>	s;
+	std::set<int>	ref;
+
+	for (int op = 0; op < 100000; ++op)
+	{
+		int	k = rng(3000);
+		if (rng(3))
+			CHECK(s.insert(k).second == ref.insert(k).second);
+		else if (rng(20))
+			CHECK(s.erase(k) == ref.erase(k));
+		else
+		{
+			s.erase(s.lower_bound(k), s.end());
+			ref.erase(ref.lower_bound(k), ref.end());
+		}
+		ft::set<int>::iterator	i = s.lower_bound(k);
+		std::set<int>::iterator	j = ref.lower_bound(k);
+		CHECK((i == s.end()) == (j == ref.end()));
+		if (j != ref.end())
+			CHECK(*i == *j);
+	}
+	CHECK(s.size() == ref.size());
+	std::set<int>::iterator	j = ref.begin();
+	for (ft::set<int>::iterator i = s.begin(); i != s.end(); ++i, ++j)
+		CHECK(*i == *j);
+}
+
+int	main()
+{
+	test_map_against_std();
+	test_set_against_std();
+	return 0;
+}
@@ -0,0 +1,229 @@
+#include "tests/check.hpp"
+#include "vector/mapped_vector.hpp"
+
+#include <cstdio>
+#include <stdexcept>
+#include <string>
+#include <sys/resource.h>
+#include <sys/stat.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <vector>
+
+struct row
+{
+	int		id;
+	double	v;
+};
+
+typedef ft::mapped_vector<row>	rows;
+
+// A scratch file per process, so parallel runs do not share it.
+static std::string	scratch(const char* name)
+{
+	char	buf[64];
+	std::snprintf(buf, sizeof(buf), "/tmp/ft_%s_%d.bin", name, (int)getpid());
+	return buf;
+}
+
+static void	test_reopen(const char* path)
+{
+	{
+		rows	m(path);
+		CHECK(m.is_open() && m.empty() && m.capacity() == 0);
+		for (int i = 0; i < 100000; ++i)
+		{
+			row	r = { i, i * 0.5 };
+			m.push_back(r);
+		}
+		m.push_back(m[7]);
+		CHECK(m.back().id == 7);
+		m.sync();
+		row	extra[3] = { { -1, 0 }, { -2, 0 }, { -3, 0 } };
+		m.append(extra, 3);
+		m.pop_back();
+		CHECK(m.size() == 100003);
+	}
+	{
+		rows	m(path, rows::read_only);
+		CHECK(m.size() == 100003 && m[99999].id == 99999 && m.back().id == -2 && m[100000].id == 7);
+		int		expected = -2;
+		for (rows::reverse_iterator it = m.rbegin(); it != m.rbegin() + 2; ++it)
+			CHECK(it->id == expected++);
+		try
+		{
+			m.push_back(m[0]);
+			CHECK(false);
+		}
+		catch (std::runtime_error&)
+		{
+		}
+		try
+		{
+			m.at(100003);
+			CHECK(false);
+		}
+		catch (std::out_of_range&)
+		{
+		}
+	}
+	{
+		rows	m(path);
+		m.resize(10);
+		row		r = { 5, 5 };
+		m.resize(20, r);
+		CHECK(m[19].id == 5 && m[9].id == 9 && m.size() == 20);
+		m.reserve(1000000);
+		CHECK(m.capacity() == 1000000 && m[3].id == 3);
+		m.clear();
+		CHECK(m.empty());
+		rows	n;
+		swap(m, n);
+		CHECK(!m.is_open() && n.is_open());
+		CHECK(m.data() == 0 && m.begin() == m.end() && m.size() == 0);
+	}
+}
+
+static void	test_bad_files(const char* path)
+{
+	try
+	{
+		ft::mapped_vector<int>	wrong_type(path);
+		CHECK(false);
+	}
+	catch (std::runtime_error&)
+	{
+	}
+	try
+	{
+		rows	missing("/nonexistent/dir/x", rows::read_only);
+		CHECK(false);
+	}
+	catch (std::runtime_error&)
+	{
+	}
+	std::string	junk = scratch("junk");
+	FILE*		f = std::fopen(junk.c_str(), "w");
+	std::fputs("hello", f);
+	std::fclose(f);
+	try
+	{
+		rows	j(junk.c_str());
+		CHECK(false);
+	}
+	catch (std::runtime_error&)
+	{
+	}
+	std::remove(junk.c_str());
+}
+
+// Random push_back, pop_back, resize, append and reopen against
+// std::vector; every reopen must see exactly what was written.
+static void	test_random(const char* path)
+{
+	ft_test::rng		rng(31);
+	std::vector<int>	r;
+	std::remove(path);
+	ft::mapped_vector<int>*	m = new ft::mapped_vector<int>(path);
+
+	for (int step = 0; step < 5000; ++step)
+	{
+		int	x = (int)rng();
+		switch (rng(r.empty() ? 1 : 6))
+		{
+			case 0:
+			case 1:
+				m->push_back(x);
+				r.push_back(x);
+				break;
+			case 2:
+				m->pop_back();
+				r.pop_back();
+				break;
+			case 3:
+			{
+				size_t	n = rng(2 * r.size() + 100);
+				m->resize(n, x);
+				r.resize(n, x);
+				break;
+			}
+			case 4:
+			{
+				int	chunk[37];
+				size_t	n = rng(37);
+				for (size_t i = 0; i < n; ++i)
+					chunk[i] = x + (int)i;
+				m->append(chunk, n);
+				r.insert(r.end(), chunk, chunk + n);
+				break;
+			}
+			default:
+				if (rng(20) == 0)
+				{
+					delete m;
+					m = new ft::mapped_vector<int>(path);
+				}
+				else
+				{
+					size_t	i = rng(r.size());
+					(*m)[i] = x;
+					r[i] = x;
+				}
+		}
+		CHECK(m->capacity() >= m->size());
+		CHECK(ft_test::same(*m, r));
+	}
+	delete m;
+}
+
+// A reserve that cannot be mapped leaves the file length and the
+// elements as they were. Runs in a child, since it caps the address space.
+static void	test_failed_remap(const char* path)
+{
+#ifndef __SANITIZE_ADDRESS__
+	pid_t	pid = fork();
+	if (pid == 0)
+	{
+		std::remove(path);
+		ft::mapped_vector<int>	v(path);
+		for (int i = 0; i < 1000; ++i)
+			v.push_back(i);
+		struct stat	st;
+		stat(path, &st);
+		off_t		before = st.st_size;
+		rlimit		limit = { 1UL << 31, 1UL << 31 };
+		setrlimit(RLIMIT_AS, &limit);
+		try
+		{
+			v.reserve(1UL << 32);
+			CHECK(false);
+		}
+		catch (std::runtime_error&)
+		{
+		}
+		stat(path, &st);
+		CHECK(st.st_size == before && v.size() == 1000 && v[999] == 999);
+		v.close();
+		CHECK(v.data() == 0 && v.begin() == v.end());
+		_exit(0);
+	}
+	int	status = 0;
+	waitpid(pid, &status, 0);
+	CHECK(WIFEXITED(status) && WEXITSTATUS(status) == 0);
+#else
+	(void)path;
+#endif
+}
+
+int	main()
+{
+	std::string	path = scratch("mapped_vector");
+
+	std::remove(path.c_str());
+	test_reopen(path.c_str());
+	test_bad_files(path.c_str());
+	test_random(path.c_str());
+	test_failed_remap(path.c_str());
+	std::remove(path.c_str());
+	return 0;
+}
@@ -0,0 +1,92 @@
+#include "tests/check.hpp"
+#include "utils/mmap_allocator.hpp"
+#include "vector/vector.hpp"
+
+#include <string>
+#include <vector>
+
+typedef ft::vector<long, ft::mmap_allocator<long> >	mapped_longs;
+
+// Grows and shrinks across MMAP_ALLOCATOR_THRESHOLD in random steps, so
+// blocks move between operator new and their own mappings both ways.
+static void	test_against_std()
+{
+	ft_test::rng		rng;
+	mapped_longs		v;
+	std::vector<long>	r;
+	const size_t		threshold = MMAP_ALLOCATOR_THRESHOLD / sizeof(long);
+
+	for (int op = 0; op < 400; ++op)
+	{
+		switch (rng(4))
+		{
+			case 0:
+			{
+				size_t	n = rng(threshold / 2);
+				for (size_t i = 0; i < n; ++i)
+				{
+					v.push_back(op * 1000003L + (long)i);
+					r.push_back(op * 1000003L + (long)i);
+				}
+				break;
+			}
+			case 1:
+			{
+				size_t	n = rng(r.size() + 1);
+				v.resize(r.size() - n);
+				r.resize(r.size() - n);
+				break;
+			}
+			case 2:
+				v.shrink_to_fit();
+				CHECK(v.capacity() == v.size());
+				break;
+			default:
+				v.reserve(v.size() + rng(threshold));
+		}
+		CHECK(v.size() == r.size());
+		if (!r.empty())
+			CHECK(v.front() == r.front() && v.back() == r.back());
+	}
+	CHECK(ft_test::same(v, r));
+}
+
+static void	test_remaps_counted()
+{
+	ft::mmap_allocator_counters&	stats = ft::mmap_allocator_stats();
+	size_t							remaps = stats.remaps.load();
+	size_t							remapped = stats.bytes_remapped.load();
+	mapped_longs					v;
+
+	for (long i = 0; i < (long)(8 * MMAP_ALLOCATOR_THRESHOLD / sizeof(long)); ++i)
+		v.push_back(i);
+	CHECK(stats.remaps.load() > remaps);
+	CHECK(stats.bytes_remapped.load() > remapped);
+	for (long i = 0; i < (long)v.size(); i += 4099)
+		CHECK(v[i] == i);
+}
+
+// Types that are not trivially relocatable never go through mremap.
+static void	test_non_relocatable()
+{
+	ft::vector<std::string, ft::mmap_allocator<std::string> >	v;
+	std::vector<std::string>									r;
+
+	for (int i = 0; i < 200000; ++i)
+	{
+		v.push_back(std::string(1 + i % 40, 'a'));
+		r.push_back(std::string(1 + i % 40, 'a'));
+	}
+	CHECK(ft_test::same(v, r));
+	v.resize(10);
+	v.shrink_to_fit();
+	CHECK(v.size() == 10 && v[9] == r[9]);
+}
+
+int	main()
+{
+	test_against_std();
+	test_remaps_counted();
+	test_non_relocatable();
+	return 0;
+}
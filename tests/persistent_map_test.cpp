@@ -0,0 +1,189 @@
+#include "tests/check.hpp"
+#include "map/persistent_map.hpp"
+#include "utils/atomic.hpp"
+#include "utils/mutex.hpp"
+
+#include <pthread.h>
+#include <map>
+#include <string>
+#include <vector>
+
+typedef ft::persistent_map<int, std::string>	persistent;
+typedef std::map<int, std::string>				reference;
+
+static void	check_same(const persistent& p, const reference& r)
+{
+	CHECK(p.size() == r.size());
+	reference::const_iterator	j = r.begin();
+	for (persistent::const_iterator i = p.begin(); i != p.end(); ++i, ++j)
+		CHECK(i->first == j->first && i->second == j->second);
+	reference::const_reverse_iterator	rj = r.rbegin();
+	for (persistent::const_iterator i = p.end(); i != p.begin(); ++rj)
+	{
+		--i;
+		CHECK(i->first == rj->first);
+	}
+}
+
+static void	test_against_std()
+{
+	ft_test::rng			rng;
+	persistent				p;
+	reference				r;
+	std::vector<persistent>	snapshots;
+	std::vector<reference>	expected;
+
+	for (int op = 0; op < 20000; ++op)
+	{
+		int			k = rng(500);
+		std::string	v(1 + op % 3, (char)('a' + op % 26));
+		switch (rng(3))
+		{
+			case 0:
+				CHECK(p.insert(ft::make_pair(k, v)) == r.insert(std::make_pair(k, v)).second);
+				break;
+			case 1:
+				CHECK(p.erase(k) == r.erase(k));
+				break;
+			default:
+				CHECK(p.insert_or_assign(k, v) == !r.count(k));
+				r[k] = v;
+		}
+		if (op % 997 == 0)
+		{
+			snapshots.push_back(p.snapshot());
+			expected.push_back(r);
+		}
+	}
+	check_same(p, r);
+	for (size_t i = 0; i < snapshots.size(); ++i)
+		check_same(snapshots[i], expected[i]);
+	for (int k = -1; k < 502; ++k)
+	{
+		persistent::const_iterator	lb = p.lower_bound(k);
+		persistent::const_iterator	ub = p.upper_bound(k);
+		reference::iterator			rlb = r.lower_bound(k);
+		reference::iterator			rub = r.upper_bound(k);
+		CHECK((lb == p.end()) == (rlb == r.end()));
+		CHECK(lb == p.end() || lb->first == rlb->first);
+		CHECK((ub == p.end()) == (rub == r.end()));
+		CHECK(ub == p.end() || ub->first == rub->first);
+		CHECK(p.count(k) == r.count(k));
+	}
+}
+
+struct throwing
+{
+	static int	countdown;
+	int			v;
+
+	throwing(int x = 0) : v(x) {}
+	throwing(const throwing& o) : v(o.v)
+	{
+		if (countdown >= 0 && countdown-- == 0)
+			throw 7;
+	}
+	throwing&	operator=(const throwing& o) { v = o.v; return *this; }
+};
+
+int	throwing::countdown = -1;
+
+// A copy that throws halfway through a path copy leaves the map as it was.
+static void	test_throwing_copies()
+{
+	ft_test::rng							rng(3);
+	ft::persistent_map<int, throwing>		m;
+	std::map<int, int>						r;
+
+	for (int op = 0; op < 20000; ++op)
+	{
+		int	k = rng(500);
+		ft::persistent_map<int, throwing>	before = m;
+		throwing::countdown = (int)rng(12);
+		try
+		{
+			if (rng(3))
+			{
+				bool	added = m.insert(ft::make_pair(k, throwing(k)));
+				throwing::countdown = -1;
+				if (added)
+					r[k] = k;
+			}
+			else
+			{
+				m.erase(k);
+				throwing::countdown = -1;
+				r.erase(k);
+			}
+		}
+		catch (int)
+		{
+			throwing::countdown = -1;
+			CHECK(m.size() == before.size());
+		}
+		throwing::countdown = -1;
+		CHECK(m.size() == r.size());
+		std::map<int, int>::iterator	j = r.begin();
+		for (ft::persistent_map<int, throwing>::const_iterator i = m.begin(); i != m.end(); ++i, ++j)
+			CHECK(i->first == j->first);
+	}
+}
+
+static persistent			published;
+static ft::mutex			published_mutex;
+static ft::atomic<int>		stop(0);
+
+static void*	read_snapshots(void*)
+{
+	while (!stop.load())
+	{
+		persistent	snap;
+		{
+			ft::lock_guard<ft::mutex>	lock(published_mutex);
+			snap = published;
+		}
+		int	prev = -1;
+		for (persistent::const_iterator i = snap.begin(); i != snap.end(); ++i)
+		{
+			CHECK(i->first > prev);
+			prev = i->first;
+		}
+	}
+	return 0;
+}
+
+// Readers walk their own snapshots while one writer keeps publishing.
+static void	test_concurrent_readers()
+{
+	ft_test::rng	rng(11);
+	pthread_t		readers[4];
+
+	for (int i = 0; i < 4; ++i)
+		pthread_create(&readers[i], 0, read_snapshots, 0);
+	for (int op = 0; op < 50000; ++op)
+	{
+		persistent	next;
+		{
+			ft::lock_guard<ft::mutex>	lock(published_mutex);
+			next = published;
+		}
+		if (rng(2))
+			next.insert(ft::make_pair((int)rng(5000), std::string("x")));
+		else
+			next.erase((int)rng(5000));
+		ft::lock_guard<ft::mutex>	lock(published_mutex);
+		published = next;
+	}
+	stop.store(1);
+	for (int i = 0; i < 4; ++i)
+		pthread_join(readers[i], 0);
+	published = persistent();
+}
+
+int	main()
+{
+	test_against_std();
+	test_throwing_copies();
+	test_concurrent_readers();
+	return 0;
+}
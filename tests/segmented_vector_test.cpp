@@ -0,0 +1,150 @@
+#include "tests/check.hpp"
+#include "vector/segmented_vector.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+typedef ft::segmented_vector<std::string, std::allocator<std::string>, 4>	small_chunks;
+
+static void	test_stable_addresses()
+{
+	ft::segmented_vector<int>	v;
+	CHECK(v.chunk_size == 1024);
+	for (int i = 0; i < 5000; ++i)
+		v.push_back(i);
+	int*	p = &v[0];
+	int*	q = &v[4999];
+	for (int i = 5000; i < 100000; ++i)
+		v.push_back(i);
+	CHECK(p == &v[0] && q == &v[4999] && *q == 4999);
+	CHECK(ft::segment_length<24>::value == 128 && ft::segment_length<5000>::value == 1);
+}
+
+static void	test_iterators()
+{
+	ft::segmented_vector<int>	v;
+	for (int i = 0; i < 100000; ++i)
+		v.push_back(i);
+
+	long	sum = 0;
+	for (ft::segmented_vector<int>::const_iterator it = v.begin(); it != v.end(); ++it)
+		sum += *it;
+	CHECK(sum == 100000L * 99999 / 2);
+	int	expected = 99999;
+	for (ft::segmented_vector<int>::reverse_iterator it = v.rbegin(); it != v.rend(); ++it)
+		CHECK(*it == expected--);
+	CHECK(v.end() - v.begin() == 100000);
+
+	std::reverse(v.begin(), v.end());
+	CHECK(v[0] == 99999);
+	std::sort(v.begin(), v.end());
+	CHECK(v[5] == 5);
+
+	std::string							arr[] = { "a", "b", "c" };
+	ft::segmented_vector<std::string>	r(arr, arr + 3);
+	ft::segmented_vector<std::string>::const_reverse_iterator	cr = r.rbegin();
+	CHECK(r[2] == "c" && *cr == "c" && cr[1] == "b");
+}
+
+static void	test_members()
+{
+	ft::segmented_vector<int>	v;
+	for (int i = 0; i < 5000; ++i)
+		v.push_back(i);
+
+	ft::segmented_vector<int>	w(v);
+	CHECK(w == v);
+	w.pop_back();
+	CHECK(w < v);
+	w.resize(3);
+	CHECK(w.size() == 3 && w.capacity() >= 3);
+	w.shrink_to_fit();
+	CHECK(w.capacity() == 1024);
+	w.resize(3000, 7);
+	CHECK(w[2999] == 7 && w[2] == 2);
+	w = v;
+	CHECK(w == v);
+	try
+	{
+		w.at(5000);
+		CHECK(false);
+	}
+	catch (std::out_of_range&)
+	{
+	}
+
+	small_chunks	s(10, "hello world long string xx");
+	for (int i = 0; i < 100; ++i)
+		s.push_back(s[i % 5]);
+	small_chunks	t(s);
+	CHECK(t == s && t.size() == 110);
+	t.resize(1);
+	t.assign(5, "a");
+	CHECK(t.back() == "a");
+	swap(s, t);
+	CHECK(s.size() == 5 && t.size() == 110);
+}
+
+// Random push_back, pop_back, resize, assign and copies against
+// std::vector, with chunks small enough that every step crosses one.
+static void	test_random()
+{
+	ft_test::rng				rng(9);
+	small_chunks				v;
+	std::vector<std::string>	r;
+
+	for (int step = 0; step < 20000; ++step)
+	{
+		std::string	value(1 + rng(30), 'a' + rng(26));
+		switch (rng(r.empty() ? 1 : 6))
+		{
+			case 0:
+			case 1:
+				v.push_back(value);
+				r.push_back(value);
+				break;
+			case 2:
+				v.pop_back();
+				r.pop_back();
+				break;
+			case 3:
+			{
+				size_t	n = rng(2 * r.size() + 2);
+				v.resize(n, value);
+				r.resize(n, value);
+				break;
+			}
+			case 4:
+				if (rng(8) == 0)
+				{
+					size_t	n = rng(40);
+					v.assign(n, value);
+					r.assign(n, value);
+				}
+				else
+				{
+					v.shrink_to_fit();
+					CHECK(v.capacity() < v.size() + 4);
+				}
+				break;
+			default:
+			{
+				small_chunks	copy(v);
+				v = copy;
+			}
+		}
+		CHECK(ft_test::same(v, r));
+		CHECK(v.capacity() >= v.size());
+	}
+}
+
+int	main()
+{
+	test_stable_addresses();
+	test_iterators();
+	test_members();
+	test_random();
+	return 0;
+}
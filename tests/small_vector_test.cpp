@@ -0,0 +1,124 @@
+#include "tests/check.hpp"
+#include "vector/small_vector.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+static int			make_int(int x) { return x; }
+static std::string	make_string(int x)
+{
+	std::ostringstream	o;
+	o << x << "-long-enough-to-live-on-the-heap";
+	return o.str();
+}
+
+// Random operations around the inline capacity of 4, including copies,
+// assignments and swaps between inline and spilled vectors.
+template<class T>
+static void	check_against_std(T (*make)(int))
+{
+	ft_test::rng	rng;
+
+	for (int round = 0; round < 3000; ++round)
+	{
+		ft::small_vector<T, 4>	v;
+		std::vector<T>			r;
+
+		for (int op = 0; op < 30; ++op)
+		{
+			switch (rng(8))
+			{
+				case 0:
+				case 1:
+				{
+					T	value = make((int)rng());
+					v.push_back(value);
+					r.push_back(value);
+					break;
+				}
+				case 2:
+					if (!r.empty())
+					{
+						size_t	at = rng(r.size());
+						v.erase(v.begin() + at);
+						r.erase(r.begin() + at);
+					}
+					break;
+				case 3:
+				{
+					size_t	a = rng(r.size() + 1);
+					size_t	b = a + rng(r.size() - a + 1);
+					v.erase(v.begin() + a, v.begin() + b);
+					r.erase(r.begin() + a, r.begin() + b);
+					break;
+				}
+				case 4:
+					if (!r.empty())
+					{
+						size_t	at = rng(r.size() + 1);
+						size_t	n = rng(5);
+						size_t	from = rng(r.size());
+						T		value = r[from];
+						v.insert(v.begin() + at, n, v[from]);
+						r.insert(r.begin() + at, n, value);
+					}
+					break;
+				case 5:
+				{
+					size_t			at = rng(r.size() + 1);
+					std::vector<T>	src;
+					for (size_t n = rng(6); n > 0; --n)
+						src.push_back(make((int)rng()));
+					v.insert(v.begin() + at, src.begin(), src.end());
+					r.insert(r.begin() + at, src.begin(), src.end());
+					break;
+				}
+				case 6:
+				{
+					size_t	n = rng(12);
+					v.resize(n);
+					r.resize(n);
+					break;
+				}
+				default:
+				{
+					ft::small_vector<T, 4>	copy(v);
+					ft::small_vector<T, 4>	other;
+					for (size_t n = rng(8); n > 0; --n)
+						other.push_back(make((int)n));
+					copy.swap(other);
+					other.swap(v);
+					v = other;
+					CHECK(ft_test::same(v, r));
+					if (!rng(3))
+					{
+						v.swap(copy);
+						v = copy;
+					}
+				}
+			}
+			CHECK(ft_test::same(v, r));
+		}
+	}
+}
+
+int	main()
+{
+	check_against_std<int>(make_int);
+	check_against_std<std::string>(make_string);
+
+	ft::small_vector<double, 3>	v(3, 1.5);
+	CHECK(v.is_inline());
+	v.push_back(2);
+	CHECK(!v.is_inline() && v.size() == 4 && v[0] == 1.5 && v[3] == 2);
+
+	ft::small_vector<int, 4>	r;
+	for (int i = 0; i < 10; ++i)
+		r.push_back(i);
+	int	i = 10;
+	for (ft::small_vector<int, 4>::reverse_iterator it = r.rbegin(); it != r.rend(); ++it)
+		CHECK(*it == --i);
+	CHECK(i == 0);
+	return 0;
+}
@@ -0,0 +1,306 @@
+#include "tests/check.hpp"
+#include "utils/snapshot.hpp"
+
+#include <cstring>
+#include <map>
+#include <set>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+// Reaches into the tree to check the red-black invariants after
+// assign_sorted and after later inserts and erases.
+struct probe : Rb_map_tree<int, ft::pair<const int, int>, std::less<int> >
+{
+	bool	valid()
+	{
+		bool	ok = _root == _end_node || _root->color == S_black;
+		black_height(_root, ok);
+		return ok;
+	}
+
+	int		black_height(node_ptr n, bool& ok)
+	{
+		if (n == _NTREE || n == _end_node)
+			return 1;
+		if (n->color == S_red && (n->left->color == S_red || (n->right != _end_node && n->right->color == S_red)))
+			ok = false;
+		if ((n->left != _NTREE && n->left->parent != n) || (n->right != _NTREE && n->right->parent != n))
+			ok = false;
+		int	l = black_height(n->left, ok);
+		int	r = black_height(n->right, ok);
+		if (l != r)
+			ok = false;
+		return l + (n->color == S_black);
+	}
+};
+
+static int	budget = -1;
+
+// Throws from its copy constructor once the budget runs out.
+struct thrower
+{
+	int	v;
+
+	thrower(int v = 0) : v(v) {}
+	thrower(const thrower& o) : v(o.v)
+	{
+		if (budget == 0)
+			throw 1;
+		if (budget > 0)
+			--budget;
+	}
+	bool	operator<(const thrower& o) const { return v < o.v; }
+	bool	operator==(const thrower& o) const { return v == o.v; }
+};
+
+static std::string	scratch(const char* name)
+{
+	char	buf[64];
+	std::snprintf(buf, sizeof(buf), "/tmp/ft_%s_%d.snap", name, (int)getpid());
+	return buf;
+}
+
+// Every size up to 300 builds a valid, balanced tree that stays valid
+// under later edits.
+static void	test_assign_sorted()
+{
+	for (int n = 0; n < 300; ++n)
+	{
+		std::vector<ft::pair<int, int> >	src;
+		for (int i = 0; i < n; ++i)
+			src.push_back(ft::make_pair(i * 2, i));
+		probe	p;
+		p.insert(ft::make_pair(99999, 1));
+		p.assign_sorted(src.begin(), n);
+		CHECK(p.valid() && (int)p.size() == n);
+		int	i = 0;
+		for (probe::iterator it = p.begin(); it != p.end(); ++it, ++i)
+			CHECK(it->first == i * 2);
+		CHECK(i == n);
+
+		for (int k = 0; k < n; k += 3)
+			p.erase(k * 2);
+		for (int k = 0; k < 50; ++k)
+			p.insert(ft::make_pair(k * 2 + 1, k));
+		CHECK(p.valid());
+	}
+
+	ft::set<thrower>		s;
+	std::vector<thrower>	v;
+	s.insert(thrower(-5));
+	for (int i = 0; i < 100; ++i)
+		v.push_back(thrower(i));
+	budget = 40;
+	try
+	{
+		s.assign_sorted(v.begin(), 100);
+		CHECK(false);
+	}
+	catch (int)
+	{
+	}
+	budget = -1;
+	CHECK(s.size() == 1 && s.begin()->v == -5);
+}
+
+static void	test_round_trip()
+{
+	std::string	vp = scratch("vector"), mp = scratch("map"), sp = scratch("set"), ep = scratch("empty");
+
+	ft::vector<double>		v;
+	ft::map<int, short>		m;
+	ft::set<char>			s;
+	for (int i = 0; i < 1001; ++i)
+		v.push_back(i * 0.5);
+	for (int i = 0; i < 777; ++i)
+		m[i * 3] = (short)i;
+	for (int i = 0; i < 77; ++i)
+		s.insert((char)i);
+	ft::save_snapshot(vp.c_str(), v);
+	ft::save_snapshot(mp.c_str(), m);
+	ft::save_snapshot(sp.c_str(), s);
+	{
+		ft::snapshot	sv(vp.c_str()), sm(mp.c_str()), ss(sp.c_str());
+		ft::vector<double>	v2;
+		ft::map<int, short>	m2;
+		ft::set<char>		s2;
+		m2[5] = 5;
+		ft::load_snapshot(sv, v2);
+		ft::load_snapshot(sm, m2);
+		ft::load_snapshot(ss, s2);
+		CHECK(v2 == v && m2 == m && s2 == s);
+		CHECK(sm.keys<int>()[2] == 6 && sm.values<short>()[776] == 776);
+		try
+		{
+			sm.values<int>();
+			CHECK(false);
+		}
+		catch (std::runtime_error&)
+		{
+		}
+		try
+		{
+			ft::load_snapshot(sv, m2);
+			CHECK(false);
+		}
+		catch (std::runtime_error&)
+		{
+		}
+		m2.insert(ft::make_pair(1, (short)1));
+		m2.erase(6);
+		CHECK(m2.size() == 777);
+	}
+
+	ft::map<int, int>	e;
+	ft::save_snapshot(ep.c_str(), e);
+	{
+		ft::snapshot		se(ep.c_str());
+		ft::map<int, int>	e2;
+		e2[1] = 1;
+		ft::load_snapshot(se, e2);
+		CHECK(e2.empty() && e2.begin() == e2.end());
+		e2[3] = 3;
+		CHECK(e2.size() == 1);
+	}
+
+	// The same bytes attached from memory, then corrupted and truncated.
+	FILE*				f = std::fopen(mp.c_str(), "rb");
+	std::vector<char>	buf(1 << 20);
+	size_t				n = std::fread(&buf[0], 1, buf.size(), f);
+	std::fclose(f);
+	void*				mem = 0;
+	CHECK(posix_memalign(&mem, 64, (n + 63) / 64 * 64) == 0);
+	char*				region = static_cast<char*>(mem);
+	std::memcpy(region, &buf[0], n);
+	{
+		ft::snapshot	r;
+		r.attach(region, n);
+		CHECK(r.size() == 777);
+	}
+	region[200] ^= 1;
+	size_t	lengths[] = { n, n - 1, 10 };
+	for (int i = 0; i < 3; ++i)
+	{
+		try
+		{
+			ft::snapshot	r;
+			r.attach(region, lengths[i]);
+			CHECK(false);
+		}
+		catch (std::runtime_error&)
+		{
+		}
+	}
+	{
+		ft::snapshot	r;
+		r.attach(region, n, false);
+		CHECK(!r.verify());
+	}
+	std::free(mem);
+	try
+	{
+		ft::snapshot	r("/nonexistent");
+		CHECK(false);
+	}
+	catch (std::runtime_error&)
+	{
+	}
+
+	std::remove(vp.c_str());
+	std::remove(mp.c_str());
+	std::remove(sp.c_str());
+	std::remove(ep.c_str());
+}
+
+// Random maps and sets saved and loaded into containers that already
+// hold other data, compared with std::map and std::set.
+static void	test_random()
+{
+	std::string		path = scratch("random");
+	ft_test::rng	rng(37);
+
+	for (int round = 0; round < 200; ++round)
+	{
+		ft::map<int, long>		m;
+		std::map<int, long>		rm;
+		ft::set<unsigned>		s;
+		std::set<unsigned>		rs;
+		for (size_t n = rng(round < 20 ? 3 : 3000); n > 0; --n)
+		{
+			int	k = (int)rng(10000) - 5000;
+			m[k] = (long)rng();
+			rm[k] = m[k];
+			unsigned	key = (unsigned)rng();
+			s.insert(key);
+			rs.insert(key);
+		}
+
+		ft::save_snapshot(path.c_str(), m);
+		ft::map<int, long>	m2;
+		m2[1] = 2;
+		{
+			ft::snapshot	snap(path.c_str(), rng(2));
+			ft::load_snapshot(snap, m2);
+		}
+		CHECK(m2.size() == rm.size());
+		std::map<int, long>::iterator	j = rm.begin();
+		for (ft::map<int, long>::iterator i = m2.begin(); i != m2.end(); ++i, ++j)
+			CHECK(i->first == j->first && i->second == j->second);
+
+		ft::save_snapshot(path.c_str(), s);
+		ft::set<unsigned>	s2;
+		s2.insert(7);
+		{
+			ft::snapshot	snap(path.c_str());
+			ft::load_snapshot(snap, s2);
+		}
+		CHECK(ft_test::same(s2, rs));
+		s2.insert(0);
+		s2.erase(s2.begin());
+		CHECK(s2.size() == rs.size() - (rs.count(0) ? 1 : 0));
+	}
+	std::remove(path.c_str());
+}
+
+// ft::swap and `using std::swap; swap(a, b)` on the classic containers.
+static void	test_swap()
+{
+	ft::set<int>	a, b;
+	a.insert(1);
+	b.insert(2);
+	b.insert(3);
+	ft::swap(a, b);
+	CHECK(a.size() == 2 && *b.begin() == 1);
+	{
+		using std::swap;
+		swap(a, b);
+	}
+	CHECK(a.size() == 1);
+
+	ft::map<int, int>	m, n;
+	m[1] = 1;
+	ft::swap(m, n);
+	CHECK(m.empty() && n[1] == 1);
+	{
+		using std::swap;
+		swap(m, n);
+	}
+	CHECK(m.size() == 1);
+
+	ft::vector<int>	v(3, 1), w;
+	ft::swap(v, w);
+	CHECK(w.size() == 3 && v.empty());
+	ft::vector<bool>	x(5, true), y;
+	ft::swap(x, y);
+	CHECK(y.size() == 5 && x.empty());
+}
+
+int	main()
+{
+	test_assign_sorted();
+	test_round_trip();
+	test_random();
+	test_swap();
+	return 0;
+}
@@ -0,0 +1,205 @@
+#include "tests/check.hpp"
+#include "vector/soa_vector.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+typedef ft::pair<int, std::string>	record;
+typedef ft::soa_vector<record>		records;
+
+static int	budget = -1;
+
+// Throws from its copy constructor once the budget runs out.
+struct thrower
+{
+	int	v;
+
+	thrower(int v = 0) : v(v) {}
+	thrower(const thrower& o) : v(o.v)
+	{
+		if (budget == 0)
+			throw 1;
+		if (budget > 0)
+			--budget;
+	}
+	bool	operator==(const thrower& o) const { return v == o.v; }
+	bool	operator<(const thrower& o) const { return v < o.v; }
+};
+
+static void	test_rows()
+{
+	records	v;
+	for (int i = 0; i < 100; ++i)
+		v.push_back(ft::make_pair(99 - i, std::string(i % 7 + 20, 'a' + i % 26)));
+	CHECK(v.size() == 100 && v[0].first == 99 && v[99].second[0] == 'a' + 99 % 26);
+	v[3].first = 1000;
+	CHECK(v.first_column()[3] == 1000);
+	v[4] = v[5];
+	CHECK(v[4] == v[5]);
+	record	row = v[6];
+	CHECK(row.first == 93);
+	CHECK(v[6] == row && row == v[6] && !(v[6] != row) && v[7] < v[6]);
+
+	std::sort(v.begin(), v.end());
+	for (int i = 1; i < 100; ++i)
+		CHECK(!(v[i] < v[i - 1]));
+	int	sum = 0;
+	for (records::const_iterator it = v.begin(); it != v.end(); ++it)
+		sum += (*it).first;
+	ft::span<const int>	column = static_cast<const records&>(v).first_column();
+	for (size_t i = 0; i < column.size(); ++i)
+		sum -= column[i];
+	CHECK(sum == 0);
+
+	records	w(v);
+	CHECK(w == v && !(w < v));
+	w.pop_back();
+	CHECK(w < v && w != v);
+	int	expected = w.back().first;
+	for (records::reverse_iterator it = w.rbegin(); it != w.rbegin() + 1; ++it)
+		CHECK((*it).first == expected);
+	CHECK(ft::equal(w.begin(), w.end(), w.begin()));
+
+	record	arr[] = { record(1, "a"), record(2, "b") };
+	records	r(arr, arr + 2);
+	CHECK(r.at(1).second == "b");
+	swap(r, w);
+	CHECK(w.size() == 2);
+	try
+	{
+		w.at(100);
+		CHECK(false);
+	}
+	catch (std::out_of_range&)
+	{
+	}
+	records	f(3, record(1, "z"));
+	CHECK(f[2].second == "z");
+	f = r;
+	CHECK(f == r);
+
+	ft::soa_vector<ft::pair<int, double> >	d;
+	d.reserve(10);
+	CHECK(d.capacity() >= 10);
+}
+
+// bool columns are stored one per byte, so they read as bool arrays.
+static void	test_bool_columns()
+{
+	ft::soa_vector<ft::pair<int, bool> >	v;
+	for (int i = 0; i < 100; ++i)
+		v.push_back(ft::make_pair(i, i % 3 == 0));
+	v[1].second = true;
+	bool&	flag = v[2].second;
+	flag = true;
+	ft::span<const bool>	flags = v.second_column();
+	int		n = 0;
+	for (size_t i = 0; i < flags.size(); ++i)
+		n += flags[i];
+	CHECK(n == 36);
+
+	v.insert(v.begin() + 5, 3, ft::make_pair(-1, true));
+	v.erase(v.begin());
+	v.resize(200, ft::make_pair(7, false));
+	ft::pair<int, bool>	row = v[4];
+	CHECK(row.first == -1 && row.second && !v[199].second);
+
+	ft::soa_vector<ft::pair<int, bool> >	c(v.begin(), v.end());
+	CHECK(c == v && !(c < v));
+
+	ft::soa_vector<ft::pair<bool, double> >	w(3, ft::make_pair(true, 1.5));
+	CHECK(w.first_column()[2] && w[1].second == 1.5);
+}
+
+// A second field that throws leaves both columns as they were.
+static void	test_throwing_second()
+{
+	ft::soa_vector<ft::pair<int, thrower> >	v;
+	for (int i = 0; i < 10; ++i)
+		v.push_back(ft::make_pair(i, thrower(i)));
+
+	for (int op = 0; op < 3; ++op)
+	{
+		budget = 0;
+		try
+		{
+			if (op == 0)
+				v.push_back(ft::make_pair(-1, thrower(-1)));
+			else if (op == 1)
+				v.insert(v.begin() + 3, 4, ft::make_pair(-1, thrower(-1)));
+			else
+				v.resize(30, ft::make_pair(-1, thrower(-1)));
+			CHECK(false);
+		}
+		catch (int)
+		{
+		}
+		budget = -1;
+		CHECK(v.size() == 10 && v.first_column().size() == 10 && v.second_column().size() == 10);
+		for (int i = 0; i < 10; ++i)
+			CHECK(v[i].first == i && v[i].second.v == i);
+	}
+}
+
+// Random operations against a std::vector of std::pair.
+static void	test_random()
+{
+	typedef std::pair<int, std::string>	pair;
+	ft_test::rng		rng(23);
+	records				v;
+	std::vector<pair>	r;
+
+	for (int step = 0; step < 20000; ++step)
+	{
+		record	value((int)rng(1000), std::string(1 + rng(20), 'a' + rng(26)));
+		pair	p(value.first, value.second);
+		switch (rng(r.empty() ? 1 : 6))
+		{
+			case 0:
+			case 1:
+				v.push_back(value);
+				r.push_back(p);
+				break;
+			case 2:
+				v.pop_back();
+				r.pop_back();
+				break;
+			case 3:
+			{
+				size_t	at = rng(r.size() + 1);
+				size_t	n = rng(8);
+				v.insert(v.begin() + at, n, value);
+				r.insert(r.begin() + at, n, p);
+				break;
+			}
+			case 4:
+			{
+				size_t	first = rng(r.size());
+				size_t	last = first + rng(std::min<size_t>(r.size() - first, 8) + 1);
+				v.erase(v.begin() + first, v.begin() + last);
+				r.erase(r.begin() + first, r.begin() + last);
+				break;
+			}
+			default:
+			{
+				size_t	i = rng(r.size());
+				v[i] = value;
+				r[i] = p;
+			}
+		}
+		CHECK(v.size() == r.size());
+		for (size_t i = 0; i < r.size(); ++i)
+			CHECK(v[i].first == r[i].first && v[i].second == r[i].second);
+	}
+}
+
+int	main()
+{
+	test_rows();
+	test_bool_columns();
+	test_throwing_second();
+	test_random();
+	return 0;
+}
@@ -0,0 +1,118 @@
+#include "tests/check.hpp"
+#include "utils/type_traits.hpp"
+#include "vector/vector.hpp"
+
+#include <cstring>
+#include <string>
+#include <unistd.h>
+#include <vector>
+
+struct user_constructed
+{
+	int	x;
+
+	user_constructed() : x(1) {}
+};
+
+struct plain
+{
+	int		x;
+	double	y;
+};
+
+static void	test_traits()
+{
+	CHECK(ft::is_trivially_default_constructible<int>::value);
+	CHECK(ft::is_trivially_default_constructible<plain>::value);
+	CHECK(!ft::is_trivially_default_constructible<user_constructed>::value);
+	CHECK(!ft::is_trivially_default_constructible<std::string>::value);
+}
+
+// append and resize_uninitialized against std::vector insert and resize,
+// including appends of the vector's own elements across a reallocation.
+static void	test_against_std()
+{
+	ft_test::rng		rng;
+	ft::vector<char>	v;
+	std::vector<char>	r;
+	char				chunk[256];
+
+	for (int op = 0; op < 20000; ++op)
+	{
+		switch (rng(4))
+		{
+			case 0:
+			{
+				size_t	n = rng(sizeof(chunk));
+				for (size_t i = 0; i < n; ++i)
+					chunk[i] = (char)rng();
+				v.append(chunk, n);
+				r.insert(r.end(), chunk, chunk + n);
+				break;
+			}
+			case 1:
+				if (!r.empty())
+				{
+					size_t				from = rng(r.size());
+					size_t				n = rng(r.size() - from + 1);
+					std::vector<char>	copy(r.begin() + from, r.begin() + from + n);
+					v.append(v.data() + from, n);
+					r.insert(r.end(), copy.begin(), copy.end());
+				}
+				break;
+			case 2:
+			{
+				size_t	n = rng(r.size() + 300);
+				size_t	old = r.size();
+				v.resize_uninitialized(n);
+				r.resize(n);
+				for (size_t i = old; i < n; ++i)
+					v[i] = r[i] = (char)rng();
+				break;
+			}
+			default:
+				if (r.size() > 100000)
+				{
+					v.resize_uninitialized(rng(100));
+					r.resize(v.size());
+				}
+		}
+		CHECK(v.size() == r.size());
+	}
+	CHECK(ft_test::same(v, r));
+
+	ft::vector<user_constructed>	u(2);
+	u.resize_uninitialized(5);
+	CHECK(u.size() == 5 && u[4].x == 1);
+	ft::vector<std::string>	s(1, "a");
+	s.resize_uninitialized(3);
+	CHECK(s.size() == 3 && s[0] == "a" && s[2].empty());
+}
+
+// The receive path the request describes: size a buffer, then read() into it.
+static void	test_read_into()
+{
+	int					fds[2];
+	ft::vector<char>	buf;
+	const char*			msg = "hello through a pipe";
+
+	CHECK(pipe(fds) == 0);
+	CHECK(write(fds[1], msg, std::strlen(msg)) == (ssize_t)std::strlen(msg));
+	close(fds[1]);
+	buf.append("> ", 2);
+	size_t	old = buf.size();
+	buf.resize_uninitialized(old + 64);
+	ssize_t	n = read(fds[0], buf.data() + old, 64);
+	close(fds[0]);
+	CHECK(n == (ssize_t)std::strlen(msg));
+	buf.resize_uninitialized(old + n);
+	CHECK(std::string(buf.data(), buf.size()) == std::string("> ") + msg);
+}
+
+int	main()
+{
+	test_traits();
+	test_against_std();
+	test_read_into();
+	return 0;
+}
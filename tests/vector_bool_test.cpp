@@ -0,0 +1,216 @@
+#include "tests/check.hpp"
+#include "vector/vector.hpp"
+
+#include <stdexcept>
+#include <vector>
+
+typedef ft::vector<bool>	bits;
+
+// Compares element by element and through count and find_next, and checks
+// that the bits past size() in the last word are still 0.
+static void	check_same(const bits& a, const std::vector<bool>& r)
+{
+	CHECK(a.size() == r.size());
+	size_t	ones = 0;
+	for (size_t i = 0; i < r.size(); ++i)
+	{
+		CHECK(a[i] == r[i]);
+		ones += r[i];
+	}
+	CHECK(a.count() == ones);
+	size_t	k = a.find_first();
+	for (size_t i = 0; i < r.size(); ++i)
+		if (r[i])
+		{
+			CHECK(k == i);
+			k = a.find_next(k);
+		}
+	CHECK(k == a.size());
+	if (a.size() % 64)
+		CHECK((a.words()[a.word_count() - 1] >> (a.size() % 64)) == 0);
+}
+
+static void	test_members()
+{
+	ft_test::rng		rng(1);
+	bits				a;
+	std::vector<bool>	r;
+
+	for (int i = 0; i < 1000; ++i)
+	{
+		bool	x = rng(2);
+		a.push_back(x);
+		r.push_back(x);
+	}
+	check_same(a, r);
+	for (int i = 0; i < 300; ++i)
+	{
+		a.pop_back();
+		r.pop_back();
+	}
+	check_same(a, r);
+	a.resize(900, true);
+	r.resize(900, true);
+	check_same(a, r);
+	a.resize(70);
+	r.resize(70);
+	check_same(a, r);
+	a.resize(1000, true);
+	r.resize(1000, true);
+	check_same(a, r);
+
+	bool	arr[] = { true, false, true };
+	a.insert(a.end(), arr, arr + 3);
+	r.insert(r.end(), arr, arr + 3);
+	check_same(a, r);
+
+	bits				b(a);
+	std::vector<bool>	rb(r);
+	CHECK(b == a);
+	b.flip();
+	rb.flip();
+	check_same(b, rb);
+
+	bits::swap(a[0], a[1]);
+	std::vector<bool>::swap(r[0], r[1]);
+	check_same(a, r);
+	size_t	n = 0;
+	for (bits::const_reverse_iterator it = a.rbegin(); it != a.rend(); ++it)
+		n += *it;
+	CHECK(n == a.count());
+
+	bits	e;
+	CHECK(e.find_first() == 0 && e.count() == 0);
+	e.shrink_to_fit();
+	bits	z(128, false);
+	z[127] = true;
+	CHECK(z.find_first() == 127 && z.find_next(127) == 128);
+	try
+	{
+		z.at(128);
+		CHECK(false);
+	}
+	catch (std::out_of_range&)
+	{
+	}
+	a.clear();
+	CHECK(a.empty());
+}
+
+// &=, |= and ^= between random operands of different sizes; the missing
+// bits of the shorter one count as 0.
+static void	test_bulk_operators()
+{
+	ft_test::rng	rng(2);
+
+	for (int round = 0; round < 300; ++round)
+	{
+		size_t				na = rng(700), nb = rng(700);
+		bits				a, b;
+		std::vector<bool>	ra, rb;
+		for (size_t i = 0; i < na; ++i)
+		{
+			a.push_back(rng(3) == 0);
+			ra.push_back(a.back());
+		}
+		for (size_t i = 0; i < nb; ++i)
+		{
+			b.push_back(rng(3) != 0);
+			rb.push_back(b.back());
+		}
+
+		for (int op = 0; op < 3; ++op)
+		{
+			bits				t(a);
+			std::vector<bool>	rt(ra);
+			if (op == 0)
+				t &= b;
+			else if (op == 1)
+				t |= b;
+			else
+				t ^= b;
+			for (size_t i = 0; i < rt.size(); ++i)
+			{
+				bool	other = i < rb.size() && rb[i];
+				rt[i] = op == 0 ? rt[i] && other : op == 1 ? rt[i] || other : rt[i] != other;
+			}
+			check_same(t, rt);
+		}
+	}
+}
+
+// Random push_back, pop_back, resize, insert, erase, assignment through
+// the proxy and flip against std::vector<bool>.
+static void	test_random()
+{
+	ft_test::rng		rng(3);
+	bits				a;
+	std::vector<bool>	r;
+
+	for (int step = 0; step < 20000; ++step)
+	{
+		bool	x = rng(2);
+		switch (rng(r.empty() ? 1 : 8))
+		{
+			case 0:
+			case 1:
+				a.push_back(x);
+				r.push_back(x);
+				break;
+			case 2:
+				a.pop_back();
+				r.pop_back();
+				break;
+			case 3:
+			{
+				size_t	n = rng(r.size() + 130);
+				a.resize(n, x);
+				r.resize(n, x);
+				break;
+			}
+			case 4:
+			{
+				size_t	at = rng(r.size() + 1);
+				size_t	n = rng(100);
+				a.insert(a.begin() + at, n, x);
+				r.insert(r.begin() + at, n, x);
+				break;
+			}
+			case 5:
+			{
+				size_t	first = rng(r.size());
+				size_t	last = first + rng(r.size() - first + 1);
+				a.erase(a.begin() + first, a.begin() + last);
+				r.erase(r.begin() + first, r.begin() + last);
+				break;
+			}
+			case 6:
+			{
+				size_t	i = rng(r.size());
+				a[i] = x;
+				r[i] = x;
+				a.insert(a.begin() + i, !x);
+				r.insert(r.begin() + i, !x);
+				size_t	j = rng(r.size());
+				a.erase(a.begin() + j);
+				r.erase(r.begin() + j);
+				break;
+			}
+			default:
+				a.flip();
+				r.flip();
+		}
+		check_same(a, r);
+	}
+}
+
+int	main()
+{
+	test_members();
+	test_bulk_operators();
+	test_random();
+
+	ft::vector<int>	vi(3, 1);
+	CHECK(vi[2] == 1);
+	return 0;
+}
@@ -0,0 +1,186 @@
+#include "tests/check.hpp"
+#include "vector/vector.hpp"
+
+#include <string>
+#include <vector>
+
+static long	allocations = 0;
+static int	budget = -1;
+
+template<class T>
+struct counting_allocator : std::allocator<T>
+{
+	template<class U>
+	struct rebind { typedef counting_allocator<U> other; };
+
+	counting_allocator() {}
+	template<class U>
+	counting_allocator(const counting_allocator<U>&) {}
+
+	T*	allocate(size_t n, const void* = 0)
+	{
+		++allocations;
+		return std::allocator<T>::allocate(n);
+	}
+};
+
+typedef ft::vector<int, counting_allocator<int> >	counted;
+
+// Throws from its copy constructor once the budget runs out.
+struct thrower
+{
+	int	v;
+
+	thrower(int v = 0) : v(v) {}
+	thrower(const thrower& o) : v(o.v)
+	{
+		if (budget == 0)
+			throw 1;
+		if (budget > 0)
+			--budget;
+	}
+	bool	operator==(const thrower& o) const { return v == o.v; }
+};
+
+static void	test_exact_capacity()
+{
+	counted	big;
+	big.reserve(1000000);
+	big.push_back(1);
+	big.push_back(2);
+
+	counted	c(big);
+	CHECK(c.capacity() == 2 && c[1] == 2);
+
+	counted	d;
+	d.reserve(10);
+	allocations = 0;
+	d = c;
+	CHECK(allocations == 0 && d.size() == 2 && d.capacity() == 10);
+	d = big;
+	CHECK(allocations == 0);
+
+	counted	e;
+	allocations = 0;
+	e = big;
+	CHECK(allocations == 1 && e.capacity() == 2);
+
+	counted	empty;
+	counted	f(empty);
+	CHECK(f.capacity() == 0);
+	f = empty;
+	CHECK(f.empty());
+}
+
+static void	test_erase_front_slack()
+{
+	counted	g;
+	for (int i = 0; i < 8; ++i)
+		g.push_back(i);
+	g.erase_front(6);
+
+	counted	h(8, 5);
+	allocations = 0;
+	g = h;
+	CHECK(allocations == 0 && g.size() == 8 && g[0] == 5 && g[7] == 5);
+}
+
+static void	test_strings()
+{
+	ft::vector<std::string>	s;
+	for (int i = 0; i < 50; ++i)
+		s.push_back(std::string(40, 'a' + i % 26));
+
+	ft::vector<std::string>	t(s);
+	CHECK(t == s);
+	ft::vector<std::string>	u(3, "x");
+	u = s;
+	CHECK(u == s);
+	u = ft::vector<std::string>(2, "y");
+	CHECK(u.size() == 2 && u[1] == "y");
+	u = u;
+	CHECK(u.size() == 2 && u[0] == "y");
+}
+
+// A copy that throws half way leaves a target that needed a new block as
+// it was; one that reuses its block is left empty but usable.
+static void	test_throwing_copy()
+{
+	ft::vector<thrower>	src;
+	for (int i = 0; i < 20; ++i)
+		src.push_back(thrower(i));
+
+	for (int small = 0; small < 2; ++small)
+	{
+		ft::vector<thrower>	dst(small ? 3 : 30, thrower(-1));
+		budget = 10;
+		try
+		{
+			dst = src;
+			CHECK(false);
+		}
+		catch (int)
+		{
+		}
+		budget = -1;
+		if (small)
+			CHECK(dst.size() == 3 && dst[0].v == -1 && dst.back().v == -1);
+		else
+			CHECK(dst.empty() && dst.capacity() == 30);
+		dst.push_back(thrower(7));
+		CHECK(dst.back().v == 7);
+	}
+
+	budget = 5;
+	try
+	{
+		ft::vector<thrower>	copy(src);
+		CHECK(false);
+	}
+	catch (int)
+	{
+	}
+	budget = -1;
+}
+
+// Random copies and assignments between vectors of random size and
+// capacity, checked against std::vector.
+static void	test_random()
+{
+	ft_test::rng	rng(11);
+
+	for (int round = 0; round < 2000; ++round)
+	{
+		ft::vector<int>		a;
+		ft::vector<int>		b;
+		std::vector<int>	r;
+
+		a.reserve(rng(100));
+		b.reserve(rng(100));
+		for (size_t n = rng(100); n > 0; --n)
+			a.push_back((int)rng());
+		for (size_t n = rng(100); n > 0; --n)
+			b.push_back((int)rng());
+		if (rng(2))
+			b.erase_front(rng(b.size() + 1));
+		r.assign(a.begin(), a.end());
+
+		size_t	cap = b.capacity();
+		b = a;
+		CHECK(ft_test::same(b, r));
+		CHECK(b.capacity() == (a.size() <= cap ? cap : a.size()));
+
+		ft::vector<int>	c(b);
+		CHECK(ft_test::same(c, r) && c.capacity() == r.size());
+	}
+}
+
+int	main()
+{
+	test_exact_capacity();
+	test_erase_front_slack();
+	test_strings();
+	test_throwing_copy();
+	test_random();
+	return 0;
+}
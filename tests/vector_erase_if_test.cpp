@@ -0,0 +1,98 @@
+#include "tests/check.hpp"
+#include "vector/vector.hpp"
+
+#include <algorithm>
+#include <string>
+#include <vector>
+
+struct below
+{
+	unsigned long	limit;
+
+	explicit below(unsigned long l) : limit(l) {}
+	bool	operator()(int x) const { return (unsigned long)x < limit; }
+	bool	operator()(const std::string& s) const { return s.size() < limit; }
+};
+
+// Counts live objects so each removed element must be destroyed once.
+struct counted
+{
+	static int	live;
+	int			v;
+
+	counted(int x = 0) : v(x) { ++live; }
+	counted(const counted& o) : v(o.v) { ++live; }
+	~counted() { --live; }
+	counted&	operator=(const counted& o) { v = o.v; return *this; }
+	bool		operator==(const counted& o) const { return v == o.v; }
+};
+
+int	counted::live = 0;
+
+struct odd
+{
+	bool	operator()(const counted& c) const { return c.v % 2 != 0; }
+};
+
+// erase_if against std::remove_if at removal rates from none to all.
+static void	test_against_std()
+{
+	ft_test::rng	rng;
+
+	for (int round = 0; round < 500; ++round)
+	{
+		ft::vector<int>				v;
+		std::vector<int>			r;
+		ft::vector<std::string>		sv;
+		std::vector<std::string>	sr;
+		size_t						n = rng(300);
+		unsigned long				limit = rng(102);
+
+		for (size_t i = 0; i < n; ++i)
+		{
+			int	x = (int)rng(100);
+			v.push_back(x);
+			r.push_back(x);
+			sv.push_back(std::string(x, 'a'));
+			sr.push_back(std::string(x, 'a'));
+		}
+		size_t	removed = r.end() - std::remove_if(r.begin(), r.end(), below(limit));
+		r.resize(r.size() - removed);
+		CHECK(ft::erase_if(v, below(limit)) == removed);
+		CHECK(ft_test::same(v, r));
+		sr.erase(std::remove_if(sr.begin(), sr.end(), below(limit)), sr.end());
+		CHECK(ft::erase_if(sv, below(limit)) == removed);
+		CHECK(ft_test::same(sv, sr));
+		if (!v.empty())
+		{
+			int	x = v[rng(v.size())];
+			r.erase(std::remove(r.begin(), r.end(), x), r.end());
+			ft::erase(v, x);
+			CHECK(ft_test::same(v, r));
+		}
+	}
+}
+
+static void	test_destroys_removed()
+{
+	{
+		ft::vector<counted>	v;
+		for (int i = 0; i < 101; ++i)
+			v.push_back(counted(i));
+		CHECK(ft::erase_if(v, odd()) == 50);
+		CHECK(counted::live == 51 && v.size() == 51);
+		// the value aliases an element that is itself removed
+		CHECK(ft::erase(v, v[0]) == 1 && v[0].v == 2);
+	}
+	CHECK(counted::live == 0);
+
+	ft::vector<int>	e;
+	CHECK(ft::erase(e, 3) == 0);
+}
+
+int	main()
+{
+	test_against_std();
+	test_destroys_removed();
+	return 0;
+}
@@ -0,0 +1,132 @@
+#include "tests/check.hpp"
+#include "vector/vector.hpp"
+
+#include <cstdio>
+#include <string>
+#include <vector>
+
+// Counts live objects so a vacated slot that is never destroyed shows up.
+struct counted
+{
+	static int	live;
+	int			v;
+
+	counted(int x = 0) : v(x) { ++live; }
+	counted(const counted& o) : v(o.v) { ++live; }
+	~counted() { --live; }
+	counted&	operator=(const counted& o) { v = o.v; return *this; }
+	bool		operator==(const counted& o) const { return v == o.v; }
+};
+
+int	counted::live = 0;
+
+// erase keeps the block; erase_front slots stay counted by capacity()
+// and are reused before the vector reallocates.
+static void	test_capacity()
+{
+	ft::vector<int>	v;
+
+	v.reserve(100);
+	for (int i = 0; i < 10; ++i)
+		v.push_back(i);
+	int*	block = v.data();
+	v.erase(v.begin());
+	CHECK(v.capacity() == 100 && v.data() == block && v[0] == 1);
+	v.reserve(100);
+	CHECK(v.data() == block);
+	v.erase_front(3);
+	CHECK(v.capacity() == 100 && v[0] == 4 && v.size() == 6);
+	v.reserve(100);
+	CHECK(v.data() == block + 3);
+	for (int i = 0; i < 94; ++i)
+		v.push_back(i);
+	CHECK(v.size() == 100 && v.capacity() == 100 && v[0] == 4 && v.data() == block);
+	v.push_back(7);
+	CHECK(v.capacity() > 100 && v[0] == 4 && v[100] == 7);
+}
+
+template<class T>
+static T	make(int i);
+
+template<>
+int			make<int>(int i) { return i; }
+template<>
+counted		make<counted>(int i) { return counted(i); }
+template<>
+std::string	make<std::string>(int i)
+{
+	char	buf[64];
+	std::sprintf(buf, "s%d-long-enough-for-the-heap", i);
+	return buf;
+}
+
+template<class T>
+static void	check_against_std()
+{
+	ft_test::rng	rng(5);
+
+	for (int round = 0; round < 2000; ++round)
+	{
+		ft::vector<T>	v;
+		std::vector<T>	r;
+
+		for (int op = 0; op < 60; ++op)
+		{
+			T	value = make<T>((int)rng());
+			switch (rng(7))
+			{
+				case 0:
+					if (!r.empty())
+					{
+						size_t	n = rng(r.size()) + 1;
+						v.erase_front(n);
+						r.erase(r.begin(), r.begin() + n);
+					}
+					break;
+				case 1:
+					if (!r.empty())
+					{
+						size_t	a = rng(r.size());
+						size_t	b = a + rng(r.size() - a + 1);
+						size_t	capacity = v.capacity();
+						CHECK(v.erase(v.begin() + a, v.begin() + b) == v.begin() + a);
+						r.erase(r.begin() + a, r.begin() + b);
+						CHECK(v.capacity() == capacity);
+					}
+					break;
+				case 2:
+					if (!r.empty())
+					{
+						size_t	a = rng(r.size());
+						CHECK(v.erase(v.begin() + a) == v.begin() + a);
+						r.erase(r.begin() + a);
+					}
+					break;
+				case 3:
+				{
+					size_t	n = rng(80);
+					size_t	capacity = v.capacity();
+					v.reserve(n);
+					CHECK(v.capacity() >= n);
+					CHECK(n > capacity || v.capacity() == capacity);
+					break;
+				}
+				default:
+					v.push_back(value);
+					r.push_back(value);
+			}
+			CHECK(v.size() <= v.capacity());
+			CHECK(ft_test::same(v, r));
+		}
+	}
+}
+
+int	main()
+{
+	test_capacity();
+	check_against_std<int>();
+	check_against_std<std::string>();
+	check_against_std<counted>();
+	CHECK(counted::live == 0);
+	return 0;
+}
@@ -0,0 +1,229 @@
+#include "tests/check.hpp"
+#include "vector/vector.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+static int	budget = -1;
+static long	allocations = 0;
+
+template<class T>
+struct counting_allocator : std::allocator<T>
+{
+	template<class U>
+	struct rebind { typedef counting_allocator<U> other; };
+
+	counting_allocator() {}
+	template<class U>
+	counting_allocator(const counting_allocator<U>&) {}
+
+	T*	allocate(size_t n, const void* = 0)
+	{
+		++allocations;
+		return std::allocator<T>::allocate(n);
+	}
+};
+
+static void	spend()
+{
+	if (budget == 0)
+		throw 1;
+	if (budget > 0)
+		--budget;
+}
+
+// Copies and assignments throw once the budget runs out.
+struct thrower
+{
+	int	v;
+
+	thrower(int i = 0) : v(i) {}
+	thrower(const thrower& o) : v(o.v) { spend(); }
+	thrower&	operator=(const thrower& o) { spend(); v = o.v; return *this; }
+};
+
+// Same, but opts into in-place shifting with the basic guarantee.
+struct relaxed : thrower
+{
+	relaxed(int i = 0) : thrower(i) {}
+};
+
+// Throwing copies, but a swap that cannot throw.
+struct swappable
+{
+	std::string	s;
+
+	swappable(const std::string& x = "") : s(x) {}
+	swappable(const swappable& o) : s(o.s) { spend(); }
+	swappable&	operator=(const swappable& o) { spend(); s = o.s; return *this; }
+	void		swap(swappable& o) { s.swap(o.s); }
+};
+
+void	swap(swappable& a, swappable& b) { a.swap(b); }
+
+namespace ft
+{
+	template<>
+	struct basic_exception_guarantee<relaxed> : public true_type {};
+	template<>
+	struct is_nothrow_swappable<swappable> : public true_type {};
+}
+
+static std::string	str(int i)
+{
+	std::ostringstream	o;
+	o << "value-" << i << "-padding-past-sso";
+	return o.str();
+}
+
+// With spare capacity, a throwing insert keeps the elements and the block.
+static void	test_strong_guarantee()
+{
+	for (int b = 0; b < 40; ++b)
+	{
+		ft::vector<thrower>		v;
+		std::vector<thrower>	src;
+
+		v.reserve(64);
+		for (int i = 0; i < 8; ++i)
+			v.push_back(thrower(i));
+		for (int i = 0; i < 5; ++i)
+			src.push_back(thrower(100 + i));
+		budget = b;
+		bool	threw = false;
+		try
+		{
+			if (b % 2)
+				v.insert(v.begin() + 3, src.begin(), src.end());
+			else
+				v.insert(v.begin() + 3, 4, thrower(7));
+		}
+		catch (int)
+		{
+			threw = true;
+		}
+		budget = -1;
+		CHECK(v.capacity() == 64);
+		CHECK(threw ? v.size() == 8 : v.size() > 8);
+		for (int i = 0; threw && i < 8; ++i)
+			CHECK(v[i].v == i);
+	}
+
+	ft_test::rng	rng(3);
+	for (int round = 0; round < 3000; ++round)
+	{
+		ft::vector<swappable>	v;
+		int						n = 1 + (int)rng(15);
+
+		v.reserve(n + 20);
+		for (int i = 0; i < n; ++i)
+			v.push_back(swappable(str(i)));
+		size_t	capacity = v.capacity();
+		int		count = 1 + (int)rng(10);
+		budget = (int)rng(25);
+		try
+		{
+			v.insert(v.begin() + rng(n + 1), count, swappable("x"));
+			budget = -1;
+			CHECK((int)v.size() == n + count);
+		}
+		catch (int)
+		{
+			budget = -1;
+			CHECK((int)v.size() == n);
+			for (int i = 0; i < n; ++i)
+				CHECK(v[i].s == str(i));
+		}
+		CHECK(v.capacity() == capacity);
+	}
+}
+
+// Inserts of std::string before the end, including ranges and values
+// taken from the vector itself.
+static void	test_against_std()
+{
+	ft_test::rng	rng(3);
+
+	for (int round = 0; round < 3000; ++round)
+	{
+		ft::vector<std::string>		v;
+		std::vector<std::string>	r;
+		int							n = (int)rng(20);
+
+		v.reserve(n + 30);
+		for (int i = 0; i < n; ++i)
+		{
+			v.push_back(str(i));
+			r.push_back(str(i));
+		}
+		size_t	at = rng(n + 1);
+		int		kind = (int)rng(3);
+		if (kind == 0)
+		{
+			size_t	count = rng(12);
+			v.insert(v.begin() + at, count, str(99));
+			r.insert(r.begin() + at, count, str(99));
+		}
+		else if (kind == 1 && n)
+		{
+			size_t						a = rng(n);
+			size_t						b = a + rng(n - a + 1);
+			std::vector<std::string>	src(r.begin() + a, r.begin() + b);
+			v.insert(v.begin() + at, v.begin() + a, v.begin() + b);
+			r.insert(r.begin() + at, src.begin(), src.end());
+		}
+		else if (n)
+		{
+			size_t		a = rng(n);
+			std::string	x = r[a];
+			v.insert(v.begin() + at, v[a]);
+			r.insert(r.begin() + at, x);
+		}
+		CHECK(ft_test::same(v, r));
+	}
+}
+
+// Inserts with spare capacity allocate at most one temporary, and only
+// for types that cannot be shifted in place.
+static void	test_allocation_counts()
+{
+	ft::vector<relaxed, counting_allocator<relaxed> >	a;
+	a.reserve(64);
+	for (int i = 0; i < 8; ++i)
+		a.push_back(relaxed(i));
+	allocations = 0;
+	relaxed	three[3];
+	a.insert(a.begin() + 2, three, three + 3);
+	CHECK(allocations == 0 && a.size() == 11 && a[2].v == 0 && a[5].v == 2);
+
+	ft::vector<int, counting_allocator<int> >	b;
+	int											zeros[500] = { 0 };
+	b.reserve(16);
+	for (int i = 0; i < 8; ++i)
+		b.push_back(i);
+	allocations = 0;
+	b.insert(b.begin() + 2, zeros, zeros + 4);
+	CHECK(allocations == 0);
+	b.insert(b.begin() + 2, zeros, zeros + 100);
+	CHECK(allocations == 1);
+	b.insert(b.begin() + 2, 500, 3);
+	CHECK(allocations == 2);
+
+	ft::vector<std::string, counting_allocator<std::string> >	c;
+	c.reserve(1000);
+	for (int i = 0; i < 500; ++i)
+		c.push_back(str(i));
+	allocations = 0;
+	c.insert(c.begin(), std::string("x"));
+	c.insert(c.begin() + 200, 3, std::string("y"));
+	CHECK(allocations == 2 && c.capacity() == 1000);
+}
+
+int	main()
+{
+	test_strong_guarantee();
+	test_against_std();
+	test_allocation_counts();
+	return 0;
+}
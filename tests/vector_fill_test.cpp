@@ -0,0 +1,91 @@
+#include "tests/check.hpp"
+#include "vector/vector.hpp"
+
+#include <string>
+
+struct p3
+{
+	short	a, b, c;
+	bool	operator==(const p3& o) const { return a == o.a && b == o.b && c == o.c; }
+};
+
+struct p12
+{
+	int		a, b, c;
+	bool	operator==(const p12& o) const { return a == o.a && b == o.b && c == o.c; }
+};
+
+struct d2
+{
+	double	a, b;
+	bool	operator==(const d2& o) const { return a == o.a && b == o.b; }
+};
+
+template<class V, class T>
+static void	check_all(const V& v, size_t from, const T& value)
+{
+	for (size_t i = from; i < v.size(); ++i)
+		CHECK(v[i] == value);
+}
+
+// Fill constructor, assign and insert at sizes around every kernel
+// boundary, into aligned and unaligned destinations, and past the
+// non-temporal threshold.
+template<class T>
+static void	check_fills(const T& value)
+{
+	ft_test::rng	rng;
+
+	for (size_t n = 0; n < 300; n += 1 + n / 3)
+	{
+		ft::vector<T>	x(n, value);
+		CHECK(x.size() == n);
+		check_all(x, 0, value);
+
+		ft::vector<T>	y;
+		y.push_back(value);
+		y.assign(n, y[0]);
+		CHECK(y.size() == n);
+		check_all(y, 0, value);
+
+		ft::vector<T>	z(1 + rng(3), value);
+		size_t			prefix = z.size();
+		z.insert(z.begin() + prefix, n, value);
+		CHECK(z.size() == prefix + n);
+		check_all(z, 0, value);
+	}
+
+	const size_t	big = (size_t)(FILL_NONTEMPORAL_THRESHOLD + (1 << 20)) / sizeof(T) + 3;
+	ft::vector<T>	a(big, value);
+	for (size_t i = 0; i < a.size(); i += 997)
+		CHECK(a[i] == value);
+	CHECK(a.back() == value);
+	ft::vector<T>	b(1, value);
+	b.insert(b.end(), big + 2, value);
+	CHECK(b.size() == big + 3 && b.back() == value && b[12345] == value);
+}
+
+int	main()
+{
+	check_fills<int>(0);
+	check_fills<int>(-1);
+	check_fills<int>(7);
+	check_fills<double>(3.25);
+	check_fills<char>('z');
+	check_fills<long long>(0x0102030405060708LL);
+	check_fills<short>(0x0101);
+	p3	a = { 1, 2, 3 };
+	check_fills(a);
+	p12	b = { 1, 2, 3 };
+	check_fills(b);
+	d2	c = { 1.5, -2 };
+	check_fills(c);
+
+	ft::vector<std::string>	s(5, "abc");
+	CHECK(s[4] == "abc");
+	s.assign(7, s[2]);
+	CHECK(s.size() == 7 && s[6] == "abc");
+	ft::vector<int>	e(0, 1);
+	CHECK(e.empty());
+	return 0;
+}
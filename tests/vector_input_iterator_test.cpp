@@ -0,0 +1,109 @@
+#include "tests/check.hpp"
+#include "map/map.hpp"
+#include "set/set.hpp"
+#include "vector/vector.hpp"
+
+#include <iterator>
+#include <list>
+#include <sstream>
+#include <string>
+#include <vector>
+
+static int	allocations = 0;
+
+template<class T>
+struct counting_allocator : std::allocator<T>
+{
+	template<class U>
+	struct rebind { typedef counting_allocator<U> other; };
+
+	counting_allocator() {}
+	template<class U>
+	counting_allocator(const counting_allocator<U>&) {}
+
+	T*	allocate(size_t n, const void* = 0)
+	{
+		++allocations;
+		return std::allocator<T>::allocate(n);
+	}
+};
+
+static std::string	numbers(const std::vector<int>& values)
+{
+	std::ostringstream	o;
+	for (size_t i = 0; i < values.size(); ++i)
+		o << values[i] << ' ';
+	return o.str();
+}
+
+// Single-pass istream ranges through the constructor, insert and assign.
+static void	test_input_iterators()
+{
+	ft_test::rng	rng;
+
+	for (int round = 0; round < 500; ++round)
+	{
+		std::vector<int>	a;
+		std::vector<int>	b;
+		for (size_t i = rng(20); i > 0; --i)
+			a.push_back((int)rng(1000));
+		for (size_t i = rng(20); i > 0; --i)
+			b.push_back((int)rng(1000));
+
+		std::istringstream	in(numbers(a));
+		ft::vector<int>		v((std::istream_iterator<int>(in)), std::istream_iterator<int>());
+		std::vector<int>	r(a);
+		CHECK(ft_test::same(v, r));
+
+		size_t				at = rng(r.size() + 1);
+		std::istringstream	more(numbers(b));
+		v.insert(v.begin() + at, std::istream_iterator<int>(more), std::istream_iterator<int>());
+		r.insert(r.begin() + at, b.begin(), b.end());
+		CHECK(ft_test::same(v, r));
+
+		std::istringstream	again(numbers(b));
+		v.assign(std::istream_iterator<int>(again), std::istream_iterator<int>());
+		CHECK(ft_test::same(v, b));
+	}
+}
+
+// Forward ranges are counted first, so the storage is allocated once.
+static void	test_forward_iterators_allocate_once()
+{
+	ft::map<int, std::string>	m;
+	for (int i = 0; i < 1000; ++i)
+		m[i] = "abcdefghijklmnopqrstuvwxyz0123456789";
+
+	allocations = 0;
+	ft::vector<ft::pair<const int, std::string>, counting_allocator<ft::pair<const int, std::string> > >	w(m.begin(), m.end());
+	CHECK(allocations == 1 && w.size() == 1000 && w[999].first == 999);
+
+	ft::set<int>	s;
+	for (int i = 0; i < 500; ++i)
+		s.insert(i * 3);
+	ft::vector<int, counting_allocator<int> >	v;
+	allocations = 0;
+	v.assign(s.begin(), s.end());
+	CHECK(allocations == 1 && v.size() == 500 && v[499] == 1497);
+	allocations = 0;
+	v.insert(v.begin() + 10, s.begin(), s.end());
+	CHECK(allocations == 1 && v.size() == 1000 && v[10] == 0 && v[510] == 30);
+
+	std::list<std::string>		l(3, "x");
+	ft::vector<std::string>		strings(l.begin(), l.end());
+	strings.insert(strings.begin() + 1, l.begin(), l.end());
+	CHECK(strings.size() == 6);
+	strings.assign(l.begin(), l.end());
+	CHECK(strings.size() == 3);
+
+	ft::vector<int>	empty(v.begin(), v.begin());
+	CHECK(empty.empty() && empty.capacity() == 0);
+	CHECK(ft::distance(m.begin(), m.end()) == 1000);
+}
+
+int	main()
+{
+	test_input_iterators();
+	test_forward_iterators_allocate_once();
+	return 0;
+}
@@ -0,0 +1,135 @@
+#include "tests/check.hpp"
+#include "vector/vector.hpp"
+
+#include <sstream>
+#include <string>
+#include <vector>
+
+static int	copies_left = -1;
+
+// Throws from its copy constructor once copies_left reaches zero.
+struct thrower
+{
+	std::string	s;
+
+	thrower(int i = 0)
+	{
+		std::ostringstream	o;
+		o << i;
+		s = o.str();
+	}
+	thrower(const thrower& o) : s(o.s)
+	{
+		if (copies_left == 0)
+			throw 1;
+		if (copies_left > 0)
+			--copies_left;
+	}
+	thrower&	operator=(const thrower& o) { s = o.s; return *this; }
+	bool		operator==(const thrower& o) const { return s == o.s; }
+};
+
+static int			make_int(int x) { return x; }
+static thrower		make_thrower(int x) { return thrower(x); }
+static std::string	make_string(int x)
+{
+	std::ostringstream	o;
+	o << x;
+	return o.str();
+}
+
+// Fill and range inserts at random positions, including fills whose value
+// is an element of the vector and ranges taken from another ft::vector.
+template<class T>
+static void	check_inserts(T (*make)(int))
+{
+	ft_test::rng	rng;
+
+	for (int round = 0; round < 2000; ++round)
+	{
+		ft::vector<T>	v;
+		std::vector<T>	r;
+
+		for (int op = 0; op < 30; ++op)
+		{
+			size_t	at = rng(v.size() + 1);
+			size_t	n = rng(6);
+			switch (rng(4))
+			{
+				case 0:
+				{
+					T	value = make((int)rng());
+					v.insert(v.begin() + at, n, value);
+					r.insert(r.begin() + at, n, value);
+					break;
+				}
+				case 1:
+					if (!r.empty())
+					{
+						size_t	from = rng(r.size());
+						T		value = r[from];
+						v.insert(v.begin() + at, n, v[from]);
+						r.insert(r.begin() + at, n, value);
+						break;
+					}
+					// fall through
+				case 2:
+				{
+					std::vector<T>	src;
+					for (size_t i = 0; i < n; ++i)
+						src.push_back(make((int)rng()));
+					v.insert(v.begin() + at, src.begin(), src.end());
+					r.insert(r.begin() + at, src.begin(), src.end());
+					break;
+				}
+				default:
+				{
+					ft::vector<T>	src;
+					for (size_t i = 0; i < n; ++i)
+						src.push_back(make((int)rng()));
+					v.insert(v.begin() + at, src.begin(), src.end());
+					r.insert(r.begin() + at, src.begin(), src.end());
+				}
+			}
+			CHECK(ft_test::same(v, r));
+		}
+	}
+}
+
+// A copy that throws while the insert reallocates leaves the vector as it was.
+static void	test_strong_guarantee()
+{
+	for (int budget = 0; budget < 40; ++budget)
+	{
+		ft::vector<thrower>		v;
+		std::vector<thrower>	src;
+
+		for (int i = 0; i < 8; ++i)
+			v.push_back(thrower(i));
+		for (int i = 0; i < 5; ++i)
+			src.push_back(thrower(100 + i));
+		copies_left = budget;
+		try
+		{
+			v.insert(v.begin() + 3, src.begin(), src.end());
+			copies_left = -1;
+			CHECK(v.size() == 13 && v[3] == thrower(100));
+		}
+		catch (int)
+		{
+			copies_left = -1;
+			CHECK(v.size() == 8);
+			for (int i = 0; i < 8; ++i)
+				CHECK(v[i] == thrower(i));
+		}
+	}
+}
+
+int	main()
+{
+	check_inserts<int>(make_int);
+	check_inserts<std::string>(make_string);
+	check_inserts<thrower>(make_thrower);
+	test_strong_guarantee();
+	return 0;
+}
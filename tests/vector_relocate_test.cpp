@@ -0,0 +1,117 @@
+#include "tests/check.hpp"
+#include "vector/vector.hpp"
+
+#include <string>
+#include <vector>
+
+struct buffer
+{
+	int		idx;
+	char	data[4096];
+};
+
+// Counts live objects so a leak or a double destruction shows up.
+struct counted
+{
+	static int	live;
+	int			v;
+
+	counted(int x = 0) : v(x) { ++live; }
+	counted(const counted& o) : v(o.v) { ++live; }
+	~counted() { --live; }
+	bool	operator==(const counted& o) const { return v == o.v; }
+};
+
+int	counted::live = 0;
+
+// Owns heap memory, but is declared safe to move bytewise.
+struct relocatable
+{
+	int*	p;
+
+	relocatable(int x = 0) : p(new int(x)) {}
+	relocatable(const relocatable& o) : p(new int(*o.p)) {}
+	~relocatable() { delete p; }
+	relocatable&	operator=(const relocatable& o) { *p = *o.p; return *this; }
+	bool			operator==(const relocatable& o) const { return *p == *o.p; }
+};
+
+namespace ft
+{
+	template<>
+	struct is_trivially_relocatable<relocatable> : ft::true_type {};
+}
+
+template<class T>
+static T	make(int i);
+
+template<>
+int				make<int>(int i) { return i; }
+template<>
+std::string		make<std::string>(int i) { return std::string(20 + i % 20, (char)('a' + i % 26)); }
+template<>
+counted			make<counted>(int i) { return counted(i); }
+template<>
+relocatable		make<relocatable>(int i) { return relocatable(i); }
+
+// push_back, pop_back and reserve in random order, including pushing an
+// element of the vector itself across a reallocation.
+template<class T>
+static void	check_growth()
+{
+	ft_test::rng		rng;
+	ft::vector<T>		v;
+	std::vector<T>		r;
+
+	for (int op = 0; op < 20000; ++op)
+	{
+		switch (rng(8))
+		{
+			case 0:
+				if (!r.empty())
+				{
+					v.pop_back();
+					r.pop_back();
+				}
+				break;
+			case 1:
+				v.reserve(v.size() + rng(100));
+				break;
+			case 2:
+				if (!r.empty())
+				{
+					size_t	i = rng(r.size());
+					v.push_back(v[i]);
+					r.push_back(r[i]);
+				}
+				break;
+			default:
+				v.push_back(make<T>(op));
+				r.push_back(make<T>(op));
+		}
+		CHECK(v.capacity() >= v.size());
+	}
+	CHECK(ft_test::same(v, r));
+}
+
+int	main()
+{
+	CHECK(ft::is_trivially_relocatable<buffer>::value);
+	CHECK(!ft::is_trivially_relocatable<std::string>::value);
+	check_growth<int>();
+	check_growth<std::string>();
+	check_growth<counted>();
+	CHECK(counted::live == 0);
+	check_growth<relocatable>();
+
+	ft::vector<buffer>	v;
+	for (int i = 0; i < 1000; ++i)
+	{
+		buffer	b;
+		b.idx = i;
+		v.push_back(b);
+	}
+	for (int i = 0; i < 1000; ++i)
+		CHECK(v[i].idx == i);
+	return 0;
+}
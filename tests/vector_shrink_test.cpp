@@ -0,0 +1,148 @@
+#include "tests/check.hpp"
+#include "utils/growth_policy.hpp"
+#include "utils/mmap_allocator.hpp"
+#include "vector/vector.hpp"
+
+#include <string>
+#include <vector>
+
+static long	allocations = 0;
+
+template<class T>
+struct counting_allocator : std::allocator<T>
+{
+	template<class U>
+	struct rebind { typedef counting_allocator<U> other; };
+
+	counting_allocator() {}
+	template<class U>
+	counting_allocator(const counting_allocator<U>&) {}
+
+	T*	allocate(size_t n, const void* = 0)
+	{
+		++allocations;
+		return std::allocator<T>::allocate(n);
+	}
+};
+
+typedef ft::shrink_hysteresis<>	hysteresis;
+
+static void	test_shrink_to_fit()
+{
+	ft::vector<int>	v(1000, 1);
+	v.erase(v.begin() + 10, v.end());
+	CHECK(v.capacity() == 1000);
+	v.shrink_to_fit();
+	CHECK(v.capacity() == 10 && v[9] == 1);
+
+	v.clear();
+	CHECK(v.capacity() == 10);
+	v.shrink_to_fit();
+	CHECK(v.capacity() == 0 && v.data() == 0);
+	v.push_back(3);
+	CHECK(v[0] == 3);
+
+	ft::vector<std::string>	s(100, "abc");
+	s.resize(3);
+	s.shrink_to_fit();
+	CHECK(s.capacity() == 3 && s[2] == "abc");
+}
+
+// The block halves once the size drops below a quarter, and push/pop
+// cycles around that boundary do not reallocate.
+static void	test_hysteresis()
+{
+	ft::vector<int, counting_allocator<int>, hysteresis>	h;
+	for (int i = 0; i < 1024; ++i)
+		h.push_back(i);
+	CHECK(h.capacity() == 1024);
+	while (h.size() > 256)
+		h.pop_back();
+	CHECK(h.capacity() == 1024);
+	h.pop_back();
+	CHECK(h.capacity() == 510 && h.back() == 254);
+
+	allocations = 0;
+	for (int i = 0; i < 100000; ++i)
+	{
+		h.push_back(i);
+		h.pop_back();
+		h.pop_back();
+		h.push_back(i);
+	}
+	CHECK(allocations < 3);
+
+	h.clear();
+	CHECK(h.capacity() != 0);
+
+	ft::vector<int, std::allocator<int>, hysteresis>	f;
+	for (int i = 0; i < 1000; ++i)
+		f.push_back(i);
+	f.erase_front(900);
+	CHECK(f.front() == 900 && f.back() == 999 && f.capacity() <= 200);
+}
+
+// Random erase, erase_front, pop_back and push_back against std::vector;
+// erase must return a valid iterator even when the block moved.
+static void	test_random()
+{
+	typedef ft::vector<std::string, std::allocator<std::string>, hysteresis>	vector;
+	ft_test::rng				rng(3);
+	vector						v;
+	std::vector<std::string>	r;
+
+	for (int step = 0; step < 20000; ++step)
+	{
+		switch (rng(r.empty() ? 1 : 4))
+		{
+			case 0:
+				for (size_t n = rng(64); n > 0; --n)
+				{
+					v.push_back(std::string(20, 'a' + rng(26)));
+					r.push_back(v.back());
+				}
+				break;
+			case 1:
+			{
+				size_t			a = rng(r.size());
+				size_t			b = a + rng(r.size() - a + 1);
+				vector::iterator	it = v.erase(v.begin() + a, v.begin() + b);
+				r.erase(r.begin() + a, r.begin() + b);
+				CHECK(it == v.begin() + a);
+				break;
+			}
+			case 2:
+			{
+				size_t	n = rng(r.size() + 1);
+				v.erase_front(n);
+				r.erase(r.begin(), r.begin() + n);
+				break;
+			}
+			default:
+				v.pop_back();
+				r.pop_back();
+		}
+		CHECK(ft_test::same(v, r));
+		if (v.size() > 16)
+			CHECK(v.capacity() <= 4 * v.size());
+	}
+}
+
+static void	test_mmap_shrink()
+{
+	ft::vector<long, ft::mmap_allocator<long> >	m(4 << 20, 7);
+	m.erase(m.begin() + (1 << 20), m.end());
+	size_t	before = ft::mmap_allocator_stats().remaps.load();
+	m.shrink_to_fit();
+	CHECK(m.capacity() == (1 << 20) && m.back() == 7);
+	CHECK(ft::mmap_allocator_stats().remaps.load() == before + 1);
+}
+
+int	main()
+{
+	test_shrink_to_fit();
+	test_hysteresis();
+	test_random();
+	test_mmap_shrink();
+	return 0;
+}
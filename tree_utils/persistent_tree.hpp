@@ -0,0 +1,611 @@
+#ifndef _PERSISTENT_TREE_HPP_
+#define _PERSISTENT_TREE_HPP_
+
+#include <new>
+#include <stdexcept>
+
+#include "../utils/utility.hpp"
+#include "../utils/iterator_traits.hpp"
+#include "../utils/atomic.hpp"
+
+//deep enough for any AVL tree that fits in memory (height 64 needs > 10^13 nodes)
+#define PERSISTENT_TREE_MAX_HEIGHT 64
+
+//Nodes are never modified once they are linked into a version, so any number
+//of versions (and threads) can share them. refs counts the parents and
+//version roots pointing at the node.
+template<typename value_type>
+struct Persistent_tree_node
+{
+	typedef Persistent_tree_node<value_type>*		node_ptr;
+
+	value_type			value_field;
+	node_ptr			left;
+	node_ptr			right;
+	int					height;
+	ft::atomic<long>	refs;
+
+	Persistent_tree_node(const value_type& value, node_ptr l, node_ptr r)
+	: value_field(value), left(l), right(r), height(1 + (heightOf(l) > heightOf(r) ? heightOf(l) : heightOf(r))), refs(1) {}
+
+	static int	heightOf(node_ptr node) { return node ? node->height : 0; }
+};
+
+//In-order iterator over one version. It keeps the path from the root down to
+//its node, so it needs no parent pointers and never writes to a node; end()
+//is the empty path, and the root is kept so that end() can be decremented.
+template<typename T>
+struct Persistent_tree_iterator
+{
+	typedef T           value_type;
+	typedef const T&    reference;
+	typedef const T&    const_reference;
+	typedef const T*    pointer;
+	typedef const T*    const_pointer;
+
+	typedef ft::bidirectional_iterator_tag	iterator_category;
+	typedef ptrdiff_t						difference_type;
+
+	typedef Persistent_tree_iterator<T>				self;
+	typedef const Persistent_tree_node<T>*			link_type;
+
+protected:
+	link_type	root;
+	link_type	stack[PERSISTENT_TREE_MAX_HEIGHT];
+	int			depth;
+
+public:
+	Persistent_tree_iterator() : root(NULL), depth(0) {}
+
+	explicit Persistent_tree_iterator(link_type r) : root(r), depth(0) {}
+
+	Persistent_tree_iterator(const self& other) : root(other.root), depth(other.depth)
+	{
+		for (int i = 0; i < depth; ++i)
+			stack[i] = other.stack[i];
+	}
+
+	self&	operator=(const self& other)
+	{
+		root = other.root;
+		depth = other.depth;
+		for (int i = 0; i < depth; ++i)
+			stack[i] = other.stack[i];
+		return *this;
+	}
+
+	//pushes node and its leftmost descendants
+	void	pushLeft(link_type node)
+	{
+		for (; node; node = node->left)
+			stack[depth++] = node;
+	}
+
+	//pushes node and its rightmost descendants
+	void	pushRight(link_type node)
+	{
+		for (; node; node = node->right)
+			stack[depth++] = node;
+	}
+
+	void	push(link_type node) { stack[depth++] = node; }
+
+	//cuts the path back to its first d nodes
+	void	truncate(int d) { depth = d; }
+
+	link_type	getNode() const { return depth ? stack[depth - 1] : NULL; }
+
+	reference	operator*() const { return getNode()->value_field; }
+
+	pointer		operator->() const { return &getNode()->value_field; }
+
+	self&	operator++()
+	{
+		link_type node = stack[depth - 1];
+
+		if (node->right)
+		{
+			pushLeft(node->right);
+			return *this;
+		}
+		//climb until coming up from a left child
+		while (--depth && stack[depth - 1]->right == node)
+			node = stack[depth - 1];
+		return *this;
+	}
+
+	self	operator++(int)
+	{
+		self	tmp = *this;
+
+		++*this;
+		return tmp;
+	}
+
+	self&	operator--()
+	{
+		if (depth == 0)
+		{
+			pushRight(root);
+			return *this;
+		}
+
+		link_type node = stack[depth - 1];
+
+		if (node->left)
+		{
+			pushRight(node->left);
+			return *this;
+		}
+		while (--depth && stack[depth - 1]->left == node)
+			node = stack[depth - 1];
+		return *this;
+	}
+
+	self	operator--(int)
+	{
+		self	tmp = *this;
+
+		--*this;
+		return tmp;
+	}
+
+	bool	operator==(const self& x) const { return getNode() == x.getNode(); }
+
+	bool	operator!=(const self& x) const { return getNode() != x.getNode(); }
+
+}; // Persistent_tree_iterator
+
+
+//One version of a persistent AVL map. Copying a version is O(1); insert and
+//erase copy only the O(log n) nodes on the root path and leave every other
+//version untouched. A node is freed by whichever version drops its last ref.
+template<typename Key,
+		typename Val,
+		typename value_compare,
+		typename Alloc = std::allocator<Persistent_tree_node<Val> > >
+class Persistent_map_tree
+{
+	typedef typename Alloc::template rebind<Persistent_tree_node<Val> >::other Node_allocator;
+
+protected:
+	typedef Persistent_tree_node<Val>		i_node;
+	typedef typename i_node::node_ptr		node_ptr;
+
+public:
+	typedef Key                 key_type;
+	typedef Val                 value_type;
+	typedef const value_type*   pointer;
+	typedef const value_type*   const_pointer;
+	typedef const value_type&   reference;
+	typedef const value_type&   const_reference;
+
+	typedef size_t              size_type;
+	typedef ptrdiff_t           difference_type;
+	typedef Alloc               allocator_type;
+
+	typedef Persistent_tree_iterator<value_type>	iterator;
+	typedef Persistent_tree_iterator<value_type>	const_iterator;
+
+protected:
+
+	node_ptr		_root;
+	value_compare	_key_compare;
+	size_type		_size;
+	Node_allocator	_alloc;
+
+public:
+
+	Persistent_map_tree() : _root(NULL), _size(0) {}
+
+	Persistent_map_tree(const value_compare& comp, const Alloc& alloc) : _root(NULL), _key_compare(comp), _size(0), _alloc(alloc) {}
+
+	Persistent_map_tree(const Persistent_map_tree& other)
+	: _root(retain(other._root)), _key_compare(other._key_compare), _size(other._size), _alloc(other._alloc) {}
+
+	~Persistent_map_tree()
+	{
+		release(_root);
+	}
+
+	Persistent_map_tree &operator=(const Persistent_map_tree &other)
+	{
+		Persistent_map_tree tmp(other);
+
+		this->swap(tmp);
+		return *this;
+	}
+
+	value_compare key_comp() const
+	{ return _key_compare; }
+
+	allocator_type  get_allocator() const
+	{ return _alloc; }
+
+	bool    empty() const
+	{ return _size == 0; }
+
+	size_type   size() const
+	{ return _size; }
+
+	size_type   max_size() const
+	{ return size_type(-1); }
+
+private:
+
+	//-------| Node creators and destructors | -----------
+
+	//takes over one reference to left and right
+	node_ptr	newNode(const value_type& value, node_ptr left, node_ptr right)
+	{
+		node_ptr ret = _alloc.allocate(1);
+
+		try { ::new (static_cast<void*>(ret)) i_node(value, left, right); }
+		catch (...)
+		{
+			_alloc.deallocate(ret, 1);
+			release(left);
+			release(right);
+			throw;
+		}
+		return ret;
+	}
+
+	static node_ptr	retain(node_ptr node)
+	{
+		if (node)
+			node->refs.fetch_add(1, ft::memory_order_relaxed);
+		return node;
+	}
+
+	void	release(node_ptr node)
+	{
+		while (node && node->refs.fetch_sub(1, ft::memory_order_acq_rel) == 1)
+		{
+			node_ptr right = node->right;
+
+			release(node->left);
+			node->~i_node();
+			_alloc.deallocate(node, 1);
+			node = right;
+		}
+	}
+
+	//-------| Algorithm base functions |-------------
+
+	//Builds value with the given (owned) children, rotating when their heights
+	//differ by two. Rotated nodes may be shared, so they are copied, not relinked.
+	//
+	//Ownership of left and right passes to the callee even if it throws, as
+	//with newNode. A call that can throw is never nested in another call's
+	//arguments: evaluation order is unspecified, so a retain() could run
+	//before it and leak when it throws.
+	node_ptr	balance(const value_type& value, node_ptr left, node_ptr right)
+	{
+		int lh = i_node::heightOf(left);
+		int rh = i_node::heightOf(right);
+
+		if (lh > rh + 1)
+			return rotateRight(value, left, right);
+		if (rh > lh + 1)
+			return rotateLeft(value, left, right);
+		return newNode(value, left, right);
+	}
+
+	//left is two levels taller than right
+	node_ptr	rotateRight(const value_type& value, node_ptr left, node_ptr right)
+	{
+		node_ptr ret;
+
+		try {
+			if (i_node::heightOf(left->left) >= i_node::heightOf(left->right))
+			{
+				node_ptr r = newNode(value, retain(left->right), right);
+
+				ret = newNode(left->value_field, retain(left->left), r);
+			}
+			else
+			{
+				node_ptr mid = left->right;
+				node_ptr r = newNode(value, retain(mid->right), right);
+				node_ptr l;
+
+				try { l = newNode(left->value_field, retain(left->left), retain(mid->left)); }
+				catch (...)
+				{
+					release(r);
+					throw;
+				}
+				ret = newNode(mid->value_field, l, r);
+			}
+		}
+		catch (...)
+		{
+			release(left);
+			throw;
+		}
+		release(left);
+		return ret;
+	}
+
+	//right is two levels taller than left
+	node_ptr	rotateLeft(const value_type& value, node_ptr left, node_ptr right)
+	{
+		node_ptr ret;
+
+		try {
+			if (i_node::heightOf(right->right) >= i_node::heightOf(right->left))
+			{
+				node_ptr l = newNode(value, left, retain(right->left));
+
+				ret = newNode(right->value_field, l, retain(right->right));
+			}
+			else
+			{
+				node_ptr mid = right->left;
+				node_ptr l = newNode(value, left, retain(mid->left));
+				node_ptr r;
+
+				try { r = newNode(right->value_field, retain(mid->right), retain(right->right)); }
+				catch (...)
+				{
+					release(l);
+					throw;
+				}
+				ret = newNode(mid->value_field, l, r);
+			}
+		}
+		catch (...)
+		{
+			release(right);
+			throw;
+		}
+		release(right);
+		return ret;
+	}
+
+	node_ptr	searchNode(const Key& to_find) const
+	{
+		node_ptr ret = _root;
+
+		while (ret)
+		{
+			if (_key_compare(to_find, ret->value_field.first))
+				ret = ret->left;
+			else if (_key_compare(ret->value_field.first, to_find))
+				ret = ret->right;
+			else
+				return ret;
+		}
+		return NULL;
+	}
+
+	//returns the new version of node with value stored under value.first
+	node_ptr	insertPath(node_ptr node, const value_type& value)
+	{
+		if (node == NULL)
+			return newNode(value, NULL, NULL);
+		if (_key_compare(value.first, node->value_field.first))
+		{
+			node_ptr left = insertPath(node->left, value);
+
+			return balance(node->value_field, left, retain(node->right));
+		}
+		if (_key_compare(node->value_field.first, value.first))
+		{
+			node_ptr right = insertPath(node->right, value);
+
+			return balance(node->value_field, retain(node->left), right);
+		}
+		return newNode(value, retain(node->left), retain(node->right));
+	}
+
+	node_ptr	eraseMin(node_ptr node)
+	{
+		if (node->left == NULL)
+			return retain(node->right);
+
+		node_ptr left = eraseMin(node->left);
+
+		return balance(node->value_field, left, retain(node->right));
+	}
+
+	//key must be in the subtree of node
+	node_ptr	erasePath(node_ptr node, const Key& key)
+	{
+		if (_key_compare(key, node->value_field.first))
+		{
+			node_ptr left = erasePath(node->left, key);
+
+			return balance(node->value_field, left, retain(node->right));
+		}
+		if (_key_compare(node->value_field.first, key))
+		{
+			node_ptr right = erasePath(node->right, key);
+
+			return balance(node->value_field, retain(node->left), right);
+		}
+		if (node->left == NULL)
+			return retain(node->right);
+		if (node->right == NULL)
+			return retain(node->left);
+
+		node_ptr min = node->right;
+		while (min->left)
+			min = min->left;
+
+		node_ptr right = eraseMin(node->right);
+
+		return balance(min->value_field, retain(node->left), right);
+	}
+
+	void	replaceRoot(node_ptr root)
+	{
+		node_ptr old = _root;
+
+		_root = root;
+		release(old);
+	}
+
+public:
+
+	//returns false, leaving the version as it is, if the key is already there
+	bool	insert(const value_type& value)
+	{
+		if (searchNode(value.first))
+			return false;
+		replaceRoot(insertPath(_root, value));
+		++_size;
+		return true;
+	}
+
+	//returns true if the key was new, false if its value was replaced
+	bool	insert_or_assign(const value_type& value)
+	{
+		bool	inserted = searchNode(value.first) == NULL;
+
+		replaceRoot(insertPath(_root, value));
+		_size += inserted;
+		return inserted;
+	}
+
+	template<typename InputIt>
+	void	insert(InputIt first, InputIt last)
+	{
+		for ( ; first != last; ++first)
+			insert(*first);
+	}
+
+	size_type	erase(const Key& key)
+	{
+		if (searchNode(key) == NULL)
+			return 0;
+		replaceRoot(erasePath(_root, key));
+		--_size;
+		return 1;
+	}
+
+	//Returns the value stored under key, which must be present, in a node
+	//only this version reaches, so it may be written to. Shared nodes on the
+	//path are copied first: O(log n), and no copy at all when this version
+	//already owns the path. The pointer is valid until the next insert,
+	//erase or copy of this version.
+	value_type*	mutableValue(const Key& key)
+	{
+		node_ptr*	link = &_root;
+
+		for (;;)
+		{
+			node_ptr node = *link;
+
+			//a node with one reference and an owned parent is ours alone
+			if (node->refs.load(ft::memory_order_acquire) != 1)
+			{
+				node_ptr left = retain(node->left);
+				node_ptr copy = newNode(node->value_field, left, retain(node->right));
+
+				*link = copy;
+				release(node);
+				node = copy;
+			}
+			if (_key_compare(key, node->value_field.first))
+				link = &node->left;
+			else if (_key_compare(node->value_field.first, key))
+				link = &node->right;
+			else
+				return &node->value_field;
+		}
+	}
+
+	//versions sharing the root of this one, itself included; 1 when empty
+	long	use_count() const
+	{ return _root ? _root->refs.load(ft::memory_order_acquire) : 1; }
+
+	void	clear()
+	{
+		replaceRoot(NULL);
+		_size = 0;
+	}
+
+	void	swap(Persistent_map_tree& other)
+	{
+		std::swap(_root, other._root);
+		std::swap(_key_compare, other._key_compare);
+		std::swap(_size, other._size);
+		std::swap(_alloc, other._alloc);
+	}
+
+	const_iterator	find(const Key& key) const
+	{
+		const_iterator it = lower_bound(key);
+
+		if (it == end() || _key_compare(key, it->first))
+			return end();
+		return it;
+	}
+
+	//the iterator keeps the whole search path and is cut back to the last
+	//node the search went left from, which is the answer
+	const_iterator	lower_bound(const Key& key) const
+	{
+		const_iterator	it(_root);
+		node_ptr		ptr = _root;
+		int				found = 0;
+
+		for (int depth = 1; ptr; ++depth)
+		{
+			it.push(ptr);
+			if (!_key_compare(ptr->value_field.first, key))
+			{
+				found = depth;
+				ptr = ptr->left;
+			}
+			else
+				ptr = ptr->right;
+		}
+		it.truncate(found);
+		return it;
+	}
+
+	const_iterator	upper_bound(const Key& key) const
+	{
+		const_iterator	it(_root);
+		node_ptr		ptr = _root;
+		int				found = 0;
+
+		for (int depth = 1; ptr; ++depth)
+		{
+			it.push(ptr);
+			if (_key_compare(key, ptr->value_field.first))
+			{
+				found = depth;
+				ptr = ptr->left;
+			}
+			else
+				ptr = ptr->right;
+		}
+		it.truncate(found);
+		return it;
+	}
+
+	ft::pair<const_iterator, const_iterator>
+	equal_range(const Key& key) const
+	{
+		return ft::make_pair(lower_bound(key), upper_bound(key));
+	}
+
+	//------| Begin and End iterators |---------
+
+	const_iterator	begin() const
+	{
+		const_iterator it(_root);
+
+		it.pushLeft(_root);
+		return it;
+	}
+
+	const_iterator	end() const
+	{ return const_iterator(_root); }
+};
+
+#endif
@@ -105,8 +105,8 @@ public:
 		_end_node->left = _end_node->right = _NTREE;
 		//in beginning root is end node;
 		_root = _end_node;
-		_size = 0;
-		insert(other.begin(), other.end());
+		_root = copyTree(other._root, NULL, other);
+		_size = other._size;
 	}
 
 	~Rb_set_tree()
@@ -143,7 +143,14 @@ private:
 	node_ptr newNode(const value_type &mapped)
 	{
 		node_ptr ret = _alloc.allocate(1);
-		_alloc.construct(ret, mapped);
+
+		try {
+			_alloc.construct(ret, mapped);
+		}
+		catch (...) {
+			_alloc.deallocate(ret, 1);
+			throw;
+		}
 		return ret;
 	}
 
@@ -154,6 +161,68 @@ private:
 
 	}
 
+	//clones the subtree of other rooted at src node by node, keeping its shape
+	//and colors, so a copy costs O(n) without any comparison or rebalancing
+	node_ptr copyTree(node_ptr src, node_ptr parent, const Rb_set_tree& other)
+	{
+		node_ptr node;
+
+		if (src == other._NTREE)
+			return _NTREE;
+		if (src == other._end_node)
+			node = _end_node;
+		else
+		{
+			node = newNode(src->value_field);
+			node->color = src->color;
+			node->left = copyTree(src->left, node, other);
+		}
+		node->parent = parent;
+		node->right = copyTree(src->right, node, other);
+		return node;
+	}
+
+	//Builds a balanced subtree from the next count values of first, in order.
+	//Each node takes the middle value of its range, so every leaf is on the
+	//deepest level or the one above; nodes on the deepest level, red_depth,
+	//are red and the rest black, which gives every path the same number of
+	//black nodes. Nothing is compared. If a copy throws, the nodes built so
+	//far are freed.
+	template<typename InputIt>
+	node_ptr buildSorted(InputIt& first, size_type count, size_type depth, size_type red_depth)
+	{
+		if (count == 0)
+			return _NTREE;
+
+		size_type	left_count = count / 2;
+		node_ptr	left = buildSorted(first, left_count, depth + 1, red_depth);
+		node_ptr	node;
+
+		try {
+			node = newNode(*first);
+		}
+		catch (...) {
+			destroyTree(left);
+			throw;
+		}
+		++first;
+		node->color = depth == red_depth ? S_red : S_black;
+		node->left = left;
+		node->right = _NTREE;
+		if (left != _NTREE)
+			left->parent = node;
+		try {
+			node->right = buildSorted(first, count - left_count - 1, depth + 1, red_depth);
+		}
+		catch (...) {
+			destroyTree(node);
+			throw;
+		}
+		if (node->right != _NTREE)
+			node->right->parent = node;
+		return node;
+	}
+
 	void destroyTree(node_ptr& node)
 	{
 		if (node == NULL)
@@ -268,6 +337,7 @@ private:
 
 		while (ret != _NTREE && ret != _end_node)
 		{
+			Rb_tree_prefetch_children(ret);
 			if(ret->value_field == to_find)
 				return (ret);
 			if(_key_compare(ret->value_field , to_find))
@@ -293,6 +363,60 @@ private:
 		return false;
 	}
 
+	//Runs the searchNode descent for count keys in lockstep. Every round moves
+	//each unfinished lane one level down and prefetches the child it moves to,
+	//so the misses of different lanes overlap instead of queueing.
+	void searchBatch(const Key* keys, node_ptr* hits, size_type count) const
+	{
+		node_ptr	cursor[RB_TREE_BATCH_WIDTH];
+		size_type	active = count;
+
+		for (size_type i = 0; i < count; ++i)
+			cursor[i] = _root;
+		while (active)
+		{
+			for (size_type i = 0; i < count; ++i)
+			{
+				node_ptr node = cursor[i];
+
+				if (node == NULL)
+					continue;
+				if (node == _NTREE || node == _end_node)
+					hits[i] = _NTREE;
+				else if (node->value_field == keys[i])
+					hits[i] = node;
+				else
+				{
+					node = _key_compare(node->value_field, keys[i]) ? node->right : node->left;
+					Rb_tree_prefetch(node);
+					cursor[i] = node;
+					continue;
+				}
+				cursor[i] = NULL;
+				--active;
+			}
+		}
+	}
+
+	//body of both find_batch overloads, writing the hits as Iter
+	template<typename Iter, typename ForwardIt, typename OutputIt>
+	OutputIt findBatch(ForwardIt first, ForwardIt last, OutputIt out) const
+	{
+		Rb_tree_key_batch<Key>	batch;
+		node_ptr				hits[RB_TREE_BATCH_WIDTH];
+
+		while (first != last)
+		{
+			batch.clear();
+			for (; !batch.full() && first != last; ++first)
+				batch.push(*first);
+			searchBatch(batch.keys(), hits, batch.size());
+			for (size_type i = 0; i < batch.size(); ++i, ++out)
+				*out = Iter(hits[i] == _NTREE ? _end_node : hits[i]);
+		}
+		return out;
+	}
+
 	void	insertFix(node_ptr node)
 	{
 		node_ptr tempNode;
@@ -397,7 +521,7 @@ bool	deleteNodeFunc(node_ptr to_del)
 			nil->parent->right = nil->left;
 		nil->left->parent = nil->parent;
 	}
-	else if (nil != _root) //case-3
+	else //case-3: the successor takes nil's place, nil may be the root
 	{
 		node2 = minNode(nil->right);
 		YMainColor = node2->color;
@@ -430,35 +554,6 @@ bool	deleteNodeFunc(node_ptr to_del)
 		node2->left->parent = node2;
 		node2->color = nil->color;
 	}
-	else
-	{
-		node2 = maxNode(nil->left);
-		YMainColor = node2->color;
-		node1 = node2->right; //NTREE
-
-		//transplant processes
-		if(node2->parent == NULL)
-			_root = node2->right;
-		else if(node2 == node2->parent->left)
-			node2->parent->left = node2->right;
-		else
-			node2->parent->right = node2->right;
-
-		node2->right->parent = node2->parent;
-		node2->right = nil->right;
-		node2->right->parent = node2;
-		//transplant processes
-		if(nil->parent == NULL)
-			_root = node2;
-		else if(nil == nil->parent->left)
-			nil->parent->left = node2;
-		else
-			nil->parent->right = node2;
-		node2->parent = nil->parent;
-		node2->left = nil->left;
-		node2->left->parent = node2;
-		node2->color = nil->color;
-	}
 	//delete nil node
 	delNode(nil);
 	//if y nodes first color is black, then deleteFix function call
@@ -470,7 +565,7 @@ bool	deleteNodeFunc(node_ptr to_del)
 
 void	deleteFix(node_ptr node)
 	{
-		node_ptr tempN;
+		node_ptr tempN = NULL;
 
 		while (node->color == S_black && node != _root )
 		{
@@ -679,6 +774,29 @@ public:
 		addEnd();
 	}
 
+	//Replaces the contents with the count values read from first, which must
+	//be sorted by key without duplicates. The tree is built directly in its
+	//final balanced shape, in O(n) and without a single descent. If a copy
+	//throws, the tree is left unchanged.
+	template<typename InputIt>
+	void assign_sorted(InputIt first, size_type count)
+	{
+		node_ptr root = NULL;
+
+		if (count)
+			root = buildSorted(first, count, 0, 63 - __builtin_clzll(count));
+		clear();
+		delEnd();
+		if (root)
+		{
+			_root = root;
+			_root->parent = NULL;
+			_root->color = S_black;
+		}
+		_size = count;
+		addEnd();
+	}
+
 	//if tree contain key, function erase it and returns 1. Else func returns 0
 	size_type 	erase(const Key& key)
 	{
@@ -748,6 +866,17 @@ public:
 		return node == _NTREE ? end() : const_iterator(node);
 	}
 
+	//Writes find(key) for every key of [first, last) to out. Each round
+	//copies up to RB_TREE_BATCH_WIDTH keys, so the range may yield
+	//temporaries.
+	template<typename ForwardIt, typename OutputIt>
+	OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out)
+	{ return findBatch<iterator>(first, last, out); }
+
+	template<typename ForwardIt, typename OutputIt>
+	OutputIt find_batch(ForwardIt first, ForwardIt last, OutputIt out) const
+	{ return findBatch<const_iterator>(first, last, out); }
+
 	iterator lower_bound(const Key& key)
 	{
 		node_ptr ptr = _root;
@@ -755,6 +884,7 @@ public:
 
 		while (ptr != _end_node && ptr != _NTREE)
 		{
+			Rb_tree_prefetch_children(ptr);
 			if (!_key_compare(ptr->value_field, key))
 			{
 				pos = ptr;
@@ -775,6 +905,7 @@ public:
 
 		while (ptr != _end_node && ptr != _NTREE)
 		{
+			Rb_tree_prefetch_children(ptr);
 			if (!_key_compare(ptr->value_field, key))
 			{
 				pos = ptr;
@@ -793,6 +924,7 @@ public:
 
 		while (ptr != _end_node && ptr != _NTREE)
 		{
+			Rb_tree_prefetch_children(ptr);
 			if (_key_compare(key, ptr->value_field))
 			{
 				pos = ptr;
@@ -811,6 +943,7 @@ public:
 
 		while (ptr != _end_node && ptr != _NTREE)
 		{
+			Rb_tree_prefetch_children(ptr);
 			if (_key_compare(key, ptr->value_field))
 			{
 				pos = ptr;
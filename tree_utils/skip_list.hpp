@@ -0,0 +1,446 @@
+#ifndef _SKIP_LIST_HPP_
+#define _SKIP_LIST_HPP_
+
+#include <new>
+
+#include "../utils/utility.hpp"
+#include "../utils/iterator_traits.hpp"
+#include "../utils/atomic.hpp"
+#include "../utils/epoch.hpp"
+#include "../utils/mutex.hpp"
+#include "../vector/vector.hpp"
+
+#define SKIP_LIST_MAX_HEIGHT 32
+
+template<typename value_type>
+struct Skip_list_node
+{
+	typedef Skip_list_node<value_type>*		node_ptr;
+	typedef ft::atomic<node_ptr>			link;
+
+	value_type	value_field;
+	int			height;
+	link		next[1]; //height links, the node is allocated with room for all of them
+
+	Skip_list_node(const value_type& value, int h) : value_field(value), height(h) {}
+
+	static size_t	bytes(int h) { return sizeof(Skip_list_node) + (h - 1) * sizeof(link); }
+};
+
+//Forward iterator that keeps an epoch slot while it points at a node, so the
+//node (and every node after it) stays allocated until the iterator moves past
+//the end or is destroyed. Elements erased meanwhile may still be visited.
+template<typename T>
+struct Skip_list_iterator
+{
+	typedef T           value_type;
+	typedef const T&    reference;
+	typedef const T&    const_reference;
+	typedef const T*    pointer;
+	typedef const T*    const_pointer;
+
+	typedef ft::forward_iterator_tag		iterator_category;
+	typedef ptrdiff_t						difference_type;
+
+	typedef Skip_list_iterator<T>			self;
+	typedef const Skip_list_node<T>*		link_type;
+
+protected:
+	ft::epoch_domain*	domain;
+	size_t				slot;
+	link_type			node;
+
+	void	leave()
+	{
+		if (node)
+			domain->exit(slot);
+		node = NULL;
+	}
+
+public:
+	Skip_list_iterator() : domain(NULL), slot(0), node(NULL) {}
+
+	//takes over slot, which the caller entered before finding x
+	Skip_list_iterator(ft::epoch_domain* d, size_t s, link_type x) : domain(d), slot(s), node(x)
+	{
+		if (node == NULL)
+			domain->exit(slot);
+	}
+
+	//the copy pins the epoch of other, not a newer one that would not cover node
+	Skip_list_iterator(const self& other) : domain(other.domain), slot(0), node(other.node)
+	{
+		if (node)
+			slot = domain->enter_at(other.slot);
+	}
+
+	~Skip_list_iterator() { leave(); }
+
+	self&	operator=(const self& other)
+	{
+		if (this != &other)
+		{
+			if (other.node)
+			{
+				size_t s = other.domain->enter_at(other.slot);
+				leave();
+				slot = s;
+			}
+			else
+				leave();
+			domain = other.domain;
+			node = other.node;
+		}
+		return *this;
+	}
+
+	link_type	getNode() const { return node; }
+
+	reference	operator*() const { return node->value_field; }
+
+	pointer		operator->() const { return &node->value_field; }
+
+	self&	operator++()
+	{
+		node = node->next[0].load(ft::memory_order_acquire);
+		if (node == NULL)
+			domain->exit(slot);
+		return *this;
+	}
+
+	self	operator++(int)
+	{
+		self	tmp = *this;
+
+		++*this;
+		return tmp;
+	}
+
+	bool	operator==(const self& x) const { return node == x.getNode(); }
+
+	bool	operator!=(const self& x) const { return node != x.getNode(); }
+
+}; // Skip_list_iterator
+
+
+//Ordered map as a skip list. Readers never lock: links are published with
+//release stores and read with acquire loads, and unlinked nodes are only
+//freed once the epoch domain shows no reader can hold them. Writers take
+//one mutex, so they are serialized among themselves but never block readers.
+template<typename Key,
+		typename Val,
+		typename value_compare,
+		typename Alloc = std::allocator<Val> >
+class Concurrent_skip_list
+{
+	typedef typename Alloc::template rebind<char>::other Byte_allocator;
+
+protected:
+	typedef Skip_list_node<Val>				i_node;
+	typedef typename i_node::node_ptr		node_ptr;
+	typedef typename i_node::link			link;
+
+	//the nodes from first to last along level 0, unlinked in epoch
+	struct Retired
+	{
+		node_ptr		first;
+		node_ptr		last;
+		unsigned long	epoch;
+	};
+
+public:
+	typedef Key                 key_type;
+	typedef Val                 value_type;
+	typedef const value_type&   const_reference;
+	typedef size_t              size_type;
+	typedef Alloc               allocator_type;
+
+	typedef Skip_list_iterator<value_type>	const_iterator;
+
+protected:
+
+	mutable link				_head[SKIP_LIST_MAX_HEIGHT];
+	mutable ft::epoch_domain	_epoch;
+	ft::mutex					_write;
+	ft::atomic<size_type>		_size;
+	value_compare				_key_compare;
+	Byte_allocator				_alloc;
+	unsigned int				_seed;
+	ft::vector<Retired>			_retired;
+
+	Concurrent_skip_list(const Concurrent_skip_list&);
+	Concurrent_skip_list& operator=(const Concurrent_skip_list&);
+
+public:
+
+	Concurrent_skip_list(const value_compare& comp = value_compare(), const Alloc& alloc = Alloc())
+	: _size(0), _key_compare(comp), _alloc(alloc), _seed(2463534242u) {}
+
+	//no other thread may use the list any more
+	~Concurrent_skip_list()
+	{
+		node_ptr node = _head[0].load(ft::memory_order_acquire);
+
+		while (node)
+		{
+			node_ptr next = node->next[0].load(ft::memory_order_relaxed);
+			delNode(node);
+			node = next;
+		}
+		for (size_type i = 0; i < _retired.size(); ++i)
+			delChain(_retired[i]);
+	}
+
+	value_compare key_comp() const
+	{ return _key_compare; }
+
+	allocator_type  get_allocator() const
+	{ return _alloc; }
+
+	bool    empty() const
+	{ return size() == 0; }
+
+	size_type   size() const
+	{ return _size.load(ft::memory_order_relaxed); }
+
+private:
+
+	//-------| Node creators and destructors | -----------
+
+	node_ptr	newNode(const value_type& value, int height)
+	{
+		char*		raw = _alloc.allocate(i_node::bytes(height));
+		node_ptr	node = reinterpret_cast<node_ptr>(raw);
+
+		try { ::new (static_cast<void*>(node)) i_node(value, height); }
+		catch (...)
+		{
+			_alloc.deallocate(raw, i_node::bytes(height));
+			throw;
+		}
+		for (int i = 1; i < height; ++i)
+			::new (static_cast<void*>(node->next + i)) link();
+		return node;
+	}
+
+	void	delNode(node_ptr node)
+	{
+		size_t bytes = i_node::bytes(node->height);
+
+		node->~i_node();
+		_alloc.deallocate(reinterpret_cast<char*>(node), bytes);
+	}
+
+	void	delChain(const Retired& r)
+	{
+		node_ptr node = r.first;
+
+		for (;;)
+		{
+			node_ptr next = node->next[0].load(ft::memory_order_relaxed);
+			bool	 done = node == r.last;
+
+			delNode(node);
+			if (done)
+				return;
+			node = next;
+		}
+	}
+
+	//geometric with p = 1/4, from a xorshift generator only writers touch
+	int		randomHeight()
+	{
+		int height = 1;
+
+		_seed ^= _seed << 13;
+		_seed ^= _seed >> 17;
+		_seed ^= _seed << 5;
+		for (unsigned int bits = _seed; (bits & 3) == 0 && height < SKIP_LIST_MAX_HEIGHT; bits >>= 2)
+			++height;
+		return height;
+	}
+
+	//Returns the first node whose key is not less than key (greater than key
+	//if strict). preds, when given, receives for every level the link array
+	//holding the link that points at that level's successor.
+	node_ptr	searchNode(const Key& key, bool strict, link** preds) const
+	{
+		link*		links = _head;
+		node_ptr	node = NULL;
+
+		for (int level = SKIP_LIST_MAX_HEIGHT - 1; level >= 0; --level)
+		{
+			node = links[level].load(ft::memory_order_acquire);
+			while (node && (strict ? !_key_compare(key, node->value_field.first)
+								   : _key_compare(node->value_field.first, key)))
+			{
+				links = node->next;
+				node = links[level].load(ft::memory_order_acquire);
+			}
+			if (preds)
+				preds[level] = links;
+		}
+		return node;
+	}
+
+	bool	isKey(node_ptr node, const Key& key) const
+	{
+		return node && !_key_compare(key, node->value_field.first);
+	}
+
+	//Retires the unlinked nodes first to last, which still chain along
+	//level 0, and frees the retired nodes no reader can reach any more.
+	void	retire(node_ptr first, node_ptr last)
+	{
+		Retired		r;
+		size_type	kept = 0;
+
+		//the unlink has to be ordered before the epoch it is tagged with
+		ft::atomic_thread_fence(ft::memory_order_seq_cst);
+		r.first = first;
+		r.last = last;
+		r.epoch = _epoch.current();
+		_retired.push_back(r);
+		_epoch.try_advance();
+		for (size_type i = 0; i < _retired.size(); ++i)
+		{
+			if (_epoch.is_safe(_retired[i].epoch))
+				delChain(_retired[i]);
+			else
+				_retired[kept++] = _retired[i];
+		}
+		while (_retired.size() > kept)
+			_retired.pop_back();
+	}
+
+public:
+
+	//returns false if the key is already present
+	bool	insert(const value_type& value)
+	{
+		ft::lock_guard<ft::mutex>	lock(_write);
+		link*						preds[SKIP_LIST_MAX_HEIGHT];
+		node_ptr					found = searchNode(value.first, false, preds);
+
+		if (isKey(found, value.first))
+			return false;
+
+		int			height = randomHeight();
+		node_ptr	node = newNode(value, height);
+
+		for (int i = 0; i < height; ++i)
+			node->next[i].store(preds[i][i].load(ft::memory_order_relaxed), ft::memory_order_relaxed);
+		for (int i = 0; i < height; ++i)
+			preds[i][i].store(node, ft::memory_order_release);
+		_size.fetch_add(1, ft::memory_order_relaxed);
+		return true;
+	}
+
+	//Replaces the node of an existing key with a new one, so readers see
+	//either the old or the new value, never a half-written one.
+	bool	insert_or_assign(const value_type& value)
+	{
+		ft::lock_guard<ft::mutex>	lock(_write);
+		link*						preds[SKIP_LIST_MAX_HEIGHT];
+		node_ptr					old = searchNode(value.first, false, preds);
+
+		if (!isKey(old, value.first))
+			old = NULL;
+
+		int			height = old ? old->height : randomHeight();
+		node_ptr	node = newNode(value, height);
+
+		for (int i = 0; i < height; ++i)
+			node->next[i].store(old ? old->next[i].load(ft::memory_order_relaxed)
+									: preds[i][i].load(ft::memory_order_relaxed), ft::memory_order_relaxed);
+		for (int i = 0; i < height; ++i)
+			preds[i][i].store(node, ft::memory_order_release);
+		if (old == NULL)
+		{
+			_size.fetch_add(1, ft::memory_order_relaxed);
+			return true;
+		}
+		retire(old, old);
+		return false;
+	}
+
+	size_type	erase(const Key& key)
+	{
+		ft::lock_guard<ft::mutex>	lock(_write);
+		link*						preds[SKIP_LIST_MAX_HEIGHT];
+		node_ptr					node = searchNode(key, false, preds);
+
+		if (!isKey(node, key))
+			return 0;
+		for (int i = node->height - 1; i >= 0; --i)
+			preds[i][i].store(node->next[i].load(ft::memory_order_relaxed), ft::memory_order_release);
+		_size.fetch_sub(1, ft::memory_order_relaxed);
+		retire(node, node);
+		return 1;
+	}
+
+	void	clear()
+	{
+		ft::lock_guard<ft::mutex>	lock(_write);
+		node_ptr					first = _head[0].load(ft::memory_order_relaxed);
+		node_ptr					last = first;
+
+		if (first == NULL)
+			return;
+		while (node_ptr next = last->next[0].load(ft::memory_order_relaxed))
+			last = next;
+		for (int i = 0; i < SKIP_LIST_MAX_HEIGHT; ++i)
+			_head[i].store(NULL, ft::memory_order_release);
+		_size.store(0, ft::memory_order_relaxed);
+		//one batch for the whole list, so clear stays O(n) behind a pinned reader
+		retire(first, last);
+	}
+
+	//copies the mapped value of key to out
+	template<typename T>
+	bool	find(const Key& key, T& out) const
+	{
+		ft::epoch_guard	guard(_epoch);
+		node_ptr		node = searchNode(key, false, NULL);
+
+		if (!isKey(node, key))
+			return false;
+		out = node->value_field.second;
+		return true;
+	}
+
+	bool	contains(const Key& key) const
+	{
+		ft::epoch_guard	guard(_epoch);
+
+		return isKey(searchNode(key, false, NULL), key);
+	}
+
+	const_iterator	lower_bound(const Key& key) const
+	{
+		size_t slot = _epoch.enter();
+
+		return const_iterator(&_epoch, slot, searchNode(key, false, NULL));
+	}
+
+	const_iterator	upper_bound(const Key& key) const
+	{
+		size_t slot = _epoch.enter();
+
+		return const_iterator(&_epoch, slot, searchNode(key, true, NULL));
+	}
+
+	//------| Begin and End iterators |---------
+
+	const_iterator	begin() const
+	{
+		size_t slot = _epoch.enter();
+
+		return const_iterator(&_epoch, slot, _head[0].load(ft::memory_order_acquire));
+	}
+
+	const_iterator	end() const
+	{ return const_iterator(); }
+};
+
+#endif
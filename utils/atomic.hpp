@@ -0,0 +1,59 @@
+#ifndef _ATOMIC_HPP_
+#define _ATOMIC_HPP_
+
+namespace ft
+{
+	enum memory_order
+	{
+		memory_order_relaxed = __ATOMIC_RELAXED,
+		memory_order_acquire = __ATOMIC_ACQUIRE,
+		memory_order_release = __ATOMIC_RELEASE,
+		memory_order_acq_rel = __ATOMIC_ACQ_REL,
+		memory_order_seq_cst = __ATOMIC_SEQ_CST
+	};
+
+	inline void	atomic_thread_fence(memory_order order)
+	{ __atomic_thread_fence(order); }
+
+	//C++98 has no std::atomic, so this wraps the GCC/Clang __atomic builtins.
+	//T must be an integral or pointer type.
+	template<class T>
+	class atomic
+	{
+	private:
+		T	value;
+
+		atomic(const atomic&);
+		atomic& operator=(const atomic&);
+
+	public:
+		atomic() : value() {}
+		explicit atomic(T v) : value(v) {}
+
+		T		load(memory_order order = memory_order_seq_cst) const
+		{ return __atomic_load_n(&value, order); }
+
+		void	store(T v, memory_order order = memory_order_seq_cst)
+		{ __atomic_store_n(&value, v, order); }
+
+		T		exchange(T v, memory_order order = memory_order_seq_cst)
+		{ return __atomic_exchange_n(&value, v, order); }
+
+		//on failure expected receives the current value
+		bool	compare_exchange_strong(T& expected, T desired, memory_order order = memory_order_seq_cst)
+		{
+			return __atomic_compare_exchange_n(&value, &expected, desired, false, order,
+						order == memory_order_acq_rel ? memory_order_acquire
+						: order == memory_order_release ? memory_order_relaxed : order);
+		}
+
+		//integral T only, the builtins count pointer offsets in bytes
+		T		fetch_add(T v, memory_order order = memory_order_seq_cst)
+		{ return __atomic_fetch_add(&value, v, order); }
+
+		T		fetch_sub(T v, memory_order order = memory_order_seq_cst)
+		{ return __atomic_fetch_sub(&value, v, order); }
+	};
+}
+
+#endif //_ATOMIC_HPP_
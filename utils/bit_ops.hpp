@@ -0,0 +1,149 @@
+#ifndef _BIT_OPS_HPP_
+#define _BIT_OPS_HPP_
+
+#include <cstddef>
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+//The popcnt instruction is not part of baseline x86-64, so unless the build
+//targets it, word counts check for it once at run time.
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(__POPCNT__)
+# define BIT_OPS_POPCNT_DISPATCH 1
+#endif
+
+namespace ft
+{
+	typedef unsigned long long	bit_word;
+
+	static const std::size_t	bits_per_word = 64;
+
+	//the set bits from lo up to, but not including, hi (0 <= lo <= hi <= 64)
+	inline bit_word	bit_range(std::size_t lo, std::size_t hi)
+	{
+		bit_word upper = hi == bits_per_word ? ~bit_word(0) : (bit_word(1) << hi) - 1;
+
+		return upper & (~bit_word(0) << lo);
+	}
+
+	//one word counted with shifts and masks, for CPUs without popcnt
+	inline std::size_t	popcount_word_swar(bit_word x)
+	{
+		x = x - ((x >> 1) & 0x5555555555555555ULL);
+		x = (x & 0x3333333333333333ULL) + ((x >> 2) & 0x3333333333333333ULL);
+		x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0FULL;
+		return static_cast<std::size_t>((x * 0x0101010101010101ULL) >> 56);
+	}
+
+	inline std::size_t	popcount_words_swar(const bit_word* words, std::size_t n)
+	{
+		std::size_t count = 0;
+
+		for (std::size_t i = 0; i < n; ++i)
+			count += popcount_word_swar(words[i]);
+		return count;
+	}
+
+#if defined(BIT_OPS_POPCNT_DISPATCH)
+	//four independent sums keep several popcnt in flight
+	__attribute__((target("popcnt")))
+	inline std::size_t	popcount_words_popcnt(const bit_word* words, std::size_t n)
+	{
+		std::size_t c0 = 0, c1 = 0, c2 = 0, c3 = 0, i = 0;
+
+		for (; i + 4 <= n; i += 4)
+		{
+			c0 += __builtin_popcountll(words[i]);
+			c1 += __builtin_popcountll(words[i + 1]);
+			c2 += __builtin_popcountll(words[i + 2]);
+			c3 += __builtin_popcountll(words[i + 3]);
+		}
+		for (; i < n; ++i)
+			c0 += __builtin_popcountll(words[i]);
+		return c0 + c1 + c2 + c3;
+	}
+#endif
+
+	//number of set bits in words[0, n)
+	inline std::size_t	popcount_words(const bit_word* words, std::size_t n)
+	{
+#if defined(BIT_OPS_POPCNT_DISPATCH)
+		static const bool has_popcnt = __builtin_cpu_supports("popcnt");
+
+		if (has_popcnt)
+			return popcount_words_popcnt(words, n);
+		return popcount_words_swar(words, n);
+#elif defined(__GNUC__)
+		std::size_t count = 0;
+
+		for (std::size_t i = 0; i < n; ++i)
+			count += __builtin_popcountll(words[i]);
+		return count;
+#else
+		return popcount_words_swar(words, n);
+#endif
+	}
+
+	//index of the lowest set bit of x, which must not be 0
+	inline std::size_t	lowest_bit(bit_word x)
+	{
+#if defined(__GNUC__)
+		return __builtin_ctzll(x);
+#else
+		std::size_t i = 0;
+
+		for (; (x & 1) == 0; x >>= 1)
+			++i;
+		return i;
+#endif
+	}
+
+	struct bit_and
+	{
+		static bit_word	apply(bit_word a, bit_word b) { return a & b; }
+#if defined(__SSE2__)
+		static __m128i	apply(__m128i a, __m128i b) { return _mm_and_si128(a, b); }
+#endif
+	};
+
+	struct bit_or
+	{
+		static bit_word	apply(bit_word a, bit_word b) { return a | b; }
+#if defined(__SSE2__)
+		static __m128i	apply(__m128i a, __m128i b) { return _mm_or_si128(a, b); }
+#endif
+	};
+
+	struct bit_xor
+	{
+		static bit_word	apply(bit_word a, bit_word b) { return a ^ b; }
+#if defined(__SSE2__)
+		static __m128i	apply(__m128i a, __m128i b) { return _mm_xor_si128(a, b); }
+#endif
+	};
+
+	//dest[i] = Op(dest[i], src[i]) for i in [0, n), 128 bits per SSE2 op
+	template <class Op>
+	void	combine_words(bit_word* dest, const bit_word* src, std::size_t n)
+	{
+		std::size_t i = 0;
+
+#if defined(__SSE2__)
+		for (; i + 8 <= n; i += 8)
+		{
+			__m128i* d = reinterpret_cast<__m128i*>(dest + i);
+			const __m128i* s = reinterpret_cast<const __m128i*>(src + i);
+
+			_mm_storeu_si128(d, Op::apply(_mm_loadu_si128(d), _mm_loadu_si128(s)));
+			_mm_storeu_si128(d + 1, Op::apply(_mm_loadu_si128(d + 1), _mm_loadu_si128(s + 1)));
+			_mm_storeu_si128(d + 2, Op::apply(_mm_loadu_si128(d + 2), _mm_loadu_si128(s + 2)));
+			_mm_storeu_si128(d + 3, Op::apply(_mm_loadu_si128(d + 3), _mm_loadu_si128(s + 3)));
+		}
+#endif
+		for (; i < n; ++i)
+			dest[i] = Op::apply(dest[i], src[i]);
+	}
+}
+
+#endif //_BIT_OPS_HPP_
@@ -0,0 +1,142 @@
+#ifndef _EPOCH_HPP_
+#define _EPOCH_HPP_
+
+#include <cstddef>
+#include <stdexcept>
+#include <sched.h>
+
+#include "atomic.hpp"
+
+//reader slots per domain, one slot per live epoch_guard
+#ifndef EPOCH_DOMAIN_SLOTS
+# define EPOCH_DOMAIN_SLOTS 256
+#endif
+
+//times enter() yields to other threads on a full domain before it throws
+#ifndef EPOCH_DOMAIN_RETRIES
+# define EPOCH_DOMAIN_RETRIES 64
+#endif
+
+namespace ft
+{
+	//Epoch-based reclamation. Readers announce the global epoch while they
+	//hold pointers into a shared structure; a writer that unlinks an object
+	//retires it with the epoch of the unlink and may free it once the global
+	//epoch is two steps further, because by then no reader can still see it.
+	class epoch_domain
+	{
+	private:
+		//state is 0 for a free slot, (epoch << 1) | 1 while a reader holds it
+		struct slot
+		{
+			ft::atomic<unsigned long>	state;
+			char						pad[64 - sizeof(unsigned long)];
+		};
+
+		slot						slots[EPOCH_DOMAIN_SLOTS];
+		ft::atomic<unsigned long>	global;
+
+		epoch_domain(const epoch_domain&);
+		epoch_domain& operator=(const epoch_domain&);
+
+		//slot this thread used last, where it starts looking next time
+		static size_t&	hint()
+		{
+			static __thread size_t last = 0;
+			return last;
+		}
+
+		//Claims a free slot holding state. When every slot stays taken the
+		//holders may well be this thread's own iterators, so waiting forever
+		//would deadlock: it gives up with std::length_error instead.
+		size_t	claim(unsigned long state)
+		{
+			size_t	i = hint();
+
+			for (int round = 0; ; ++round)
+			{
+				for (size_t n = 0; n < EPOCH_DOMAIN_SLOTS; ++n, i = (i + 1) % EPOCH_DOMAIN_SLOTS)
+				{
+					unsigned long	expected = 0;
+
+					if (slots[i].state.load(ft::memory_order_relaxed) == 0
+						&& slots[i].state.compare_exchange_strong(expected, state))
+					{
+						//the announcement must be visible before the first read it protects
+						ft::atomic_thread_fence(ft::memory_order_seq_cst);
+						hint() = i;
+						return i;
+					}
+				}
+				if (round == EPOCH_DOMAIN_RETRIES)
+					throw std::length_error("epoch_domain: out of reader slots");
+				sched_yield();
+			}
+		}
+
+	public:
+		epoch_domain() : global(0) {}
+
+		//claims a slot in the current epoch and returns its index
+		size_t	enter()
+		{
+			return claim((current() << 1) | 1);
+		}
+
+		//Claims a slot in the epoch slot source announces, which its holder
+		//keeps for the duration of the call. Whatever source protects stays
+		//protected by the new slot after source exits.
+		size_t	enter_at(size_t source)
+		{
+			return claim(slots[source].state.load(ft::memory_order_relaxed));
+		}
+
+		void	exit(size_t i)
+		{
+			slots[i].state.store(0, ft::memory_order_release);
+		}
+
+		unsigned long	current() const
+		{
+			return global.load(ft::memory_order_seq_cst);
+		}
+
+		//moves the global epoch on if every active reader has caught up with it
+		bool	try_advance()
+		{
+			unsigned long	epoch = current();
+
+			for (size_t i = 0; i < EPOCH_DOMAIN_SLOTS; ++i)
+			{
+				unsigned long state = slots[i].state.load(ft::memory_order_seq_cst);
+
+				if ((state & 1) && (state >> 1) != epoch)
+					return false;
+			}
+			return global.compare_exchange_strong(epoch, epoch + 1);
+		}
+
+		//true once nothing retired in epoch can be reached by any reader
+		bool	is_safe(unsigned long epoch) const
+		{
+			return epoch + 2 <= current();
+		}
+	};
+
+	//holds an epoch_domain slot for the lifetime of a scope
+	class epoch_guard
+	{
+	private:
+		epoch_domain&	domain;
+		size_t			index;
+
+		epoch_guard(const epoch_guard&);
+		epoch_guard& operator=(const epoch_guard&);
+
+	public:
+		explicit epoch_guard(epoch_domain& d) : domain(d), index(d.enter()) {}
+		~epoch_guard() { domain.exit(index); }
+	};
+}
+
+#endif //_EPOCH_HPP_
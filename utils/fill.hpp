@@ -0,0 +1,116 @@
+#ifndef _FILL_HPP_
+#define _FILL_HPP_
+
+#include <cstring> // memset, memcpy
+#include <cstddef>
+
+#if defined(__SSE2__)
+# include <emmintrin.h>
+#endif
+
+//Fills of at least this many bytes bypass the cache with non-temporal
+//stores: the data would not fit in the last level cache anyway, and going
+//around it keeps the rest of the working set there. Define it to 0 to turn
+//them off entirely.
+#ifndef FILL_NONTEMPORAL_THRESHOLD
+# define FILL_NONTEMPORAL_THRESHOLD (32UL << 20)
+#endif
+
+namespace ft
+{
+	//true, with the byte in byte, if every byte of value is the same
+	template <class T>
+	inline bool	is_byte_splat(const T& value, unsigned char& byte)
+	{
+		const unsigned char* p = reinterpret_cast<const unsigned char*>(&value);
+
+		for (size_t i = 1; i < sizeof(T); ++i)
+			if (p[i] != p[0])
+				return false;
+		byte = p[0];
+		return true;
+	}
+
+	//Writes count copies of value from dest on by repeatedly doubling the
+	//filled prefix with memcpy, for element sizes SIMD patterns cannot tile.
+	template <class T>
+	inline void	fill_doubling(T* dest, size_t count, const T& value)
+	{
+		if (count == 0)
+			return;
+		std::memcpy(static_cast<void*>(dest), static_cast<const void*>(&value), sizeof(T));
+		for (size_t done = 1; done < count; done *= 2)
+		{
+			size_t n = done < count - done ? done : count - done;
+			std::memcpy(static_cast<void*>(dest + done), static_cast<const void*>(dest), n * sizeof(T));
+		}
+	}
+
+#if defined(__SSE2__)
+	//sizeof(T) divides 16, so every 16 byte block dest holds starts with a
+	//whole element and gets the same pattern
+	template <class T>
+	void	fill_sse2(T* dest, size_t count, const T& value)
+	{
+		unsigned char	pattern[16];
+		T*				end = dest + count;
+
+		for (size_t i = 0; i < 16; i += sizeof(T))
+			std::memcpy(pattern + i, static_cast<const void*>(&value), sizeof(T));
+
+		__m128i	v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(pattern));
+		bool	stream = FILL_NONTEMPORAL_THRESHOLD && count * sizeof(T) >= FILL_NONTEMPORAL_THRESHOLD
+					&& reinterpret_cast<size_t>(dest) % sizeof(T) == 0;
+
+		if (stream)
+		{
+			//head up to the first 16 byte boundary, which an element starts on
+			for (; dest != end && reinterpret_cast<size_t>(dest) % 16 != 0; ++dest)
+				std::memcpy(static_cast<void*>(dest), static_cast<const void*>(&value), sizeof(T));
+			for (; static_cast<size_t>(end - dest) * sizeof(T) >= 64; dest += 64 / sizeof(T))
+			{
+				__m128i* p = reinterpret_cast<__m128i*>(dest);
+				_mm_stream_si128(p, v);
+				_mm_stream_si128(p + 1, v);
+				_mm_stream_si128(p + 2, v);
+				_mm_stream_si128(p + 3, v);
+			}
+			_mm_sfence();
+		}
+		else
+		{
+			for (; static_cast<size_t>(end - dest) * sizeof(T) >= 64; dest += 64 / sizeof(T))
+			{
+				__m128i* p = reinterpret_cast<__m128i*>(dest);
+				_mm_storeu_si128(p, v);
+				_mm_storeu_si128(p + 1, v);
+				_mm_storeu_si128(p + 2, v);
+				_mm_storeu_si128(p + 3, v);
+			}
+		}
+		for (; dest != end; ++dest)
+			std::memcpy(static_cast<void*>(dest), static_cast<const void*>(&value), sizeof(T));
+	}
+#endif
+
+	//Writes count copies of value to dest, which may be raw storage since T
+	//must be trivially copyable. Values made of one repeated byte (0, -1,
+	//'a', ...) take memset; others take 16 byte SIMD stores when sizeof(T)
+	//divides 16, and a doubling memcpy otherwise.
+	template <class T>
+	void	fill_trivial(T* dest, size_t count, const T& value)
+	{
+		unsigned char byte;
+
+		if (is_byte_splat(value, byte))
+			std::memset(static_cast<void*>(dest), byte, count * sizeof(T));
+#if defined(__SSE2__)
+		else if (16 % sizeof(T) == 0)
+			fill_sse2(dest, count, value);
+#endif
+		else
+			fill_doubling(dest, count, value);
+	}
+}
+
+#endif //_FILL_HPP_
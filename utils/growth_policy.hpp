@@ -0,0 +1,99 @@
+#ifndef _GROWTH_POLICY_HPP_
+#define _GROWTH_POLICY_HPP_
+
+#include <cstddef>
+
+//Growth policies decide the capacity a vector moves to once it needs room
+//for more elements than it has: grow(capacity, required, elem_size) returns
+//a capacity of at least required. They are passed as the third template
+//argument of ft::vector and are used by push_back, insert, resize and assign.
+//
+//After erase and pop_back the vector also asks shrink(capacity, size,
+//elem_size) for the capacity it should move down to; returning capacity
+//keeps the block. Deriving from growth_policy_base never shrinks.
+
+namespace ft
+{
+	struct growth_policy_base
+	{
+		static std::size_t	shrink(std::size_t capacity, std::size_t, std::size_t)
+		{
+			return capacity;
+		}
+	};
+
+	//capacity * 2: fewest reallocations, up to half the block unused
+	struct growth_double : public growth_policy_base
+	{
+		static std::size_t	grow(std::size_t capacity, std::size_t required, std::size_t)
+		{
+			std::size_t next = capacity * 2;
+
+			return next < required ? required : next;
+		}
+	};
+
+	//capacity * 1.5: at most a third unused, and freed blocks can be reused
+	//by later growth steps
+	struct growth_golden : public growth_policy_base
+	{
+		static std::size_t	grow(std::size_t capacity, std::size_t required, std::size_t)
+		{
+			std::size_t next = capacity + capacity / 2;
+
+			return next < required ? required : next;
+		}
+	};
+
+	//capacity * 1.5 rounded up to the size classes of malloc-style allocators
+	//(multiples of 16 up to 64 bytes, then four classes per power of two), so
+	//the slack the allocator would hand out anyway becomes capacity
+	struct growth_size_class : public growth_policy_base
+	{
+		static std::size_t	grow(std::size_t capacity, std::size_t required, std::size_t elem_size)
+		{
+			std::size_t bytes = growth_golden::grow(capacity, required, elem_size) * elem_size;
+			std::size_t step = 16;
+
+			if (bytes > 64)
+			{
+				std::size_t power = 64;
+				while (power * 2 < bytes)
+					power *= 2;
+				step = power / 4;
+			}
+			return (bytes + step - 1) / step * step / elem_size;
+		}
+	};
+
+	//capacity * 2 rounded up to whole 4 KiB pages, for large buffers that end
+	//up in their own mapping
+	struct growth_page_aligned : public growth_policy_base
+	{
+		static std::size_t	grow(std::size_t capacity, std::size_t required, std::size_t elem_size)
+		{
+			const std::size_t page = 4096;
+			std::size_t bytes = growth_double::grow(capacity, required, elem_size) * elem_size;
+
+			return (bytes + page - 1) / page * page / elem_size;
+		}
+	};
+
+	//Growth plus automatic shrinking: once size falls below Num/Den of the
+	//capacity, the block moves down to twice the size. A shrunk vector is
+	//half full, so it has to double before growing again and lose half its
+	//elements before shrinking again; no push/pop pattern can make it
+	//reallocate on every call. Keep Num/Den below the 1/2 this leaves.
+	template <class Growth = growth_double, std::size_t Num = 1, std::size_t Den = 4>
+	struct shrink_hysteresis : public Growth
+	{
+		static std::size_t	shrink(std::size_t capacity, std::size_t size, std::size_t)
+		{
+			if (size * Den >= capacity * Num)
+				return capacity;
+			return size * 2;
+		}
+	};
+}
+
+#endif //_GROWTH_POLICY_HPP_
@@ -0,0 +1,91 @@
+#ifndef _INDEX_ITERATOR_HPP_
+#define _INDEX_ITERATOR_HPP_
+
+#include <cstddef>
+#include <iterator> //std::random_access_iterator_tag
+
+namespace ft
+{
+	//Random access iterator over a container that is not one contiguous
+	//array: it keeps the container and an index, and dereferences through
+	//the container's operator[]. Container is const for const iterators.
+	template <class Container, class Value, class Reference, class Pointer>
+	class index_iterator
+	{
+	public:
+		typedef Value								value_type;
+		typedef std::ptrdiff_t						difference_type;
+		typedef Pointer								pointer;
+		typedef Pointer								const_pointer;
+		typedef Reference							reference;
+		typedef Reference							const_reference;
+		typedef std::random_access_iterator_tag		iterator_category;
+
+	private:
+		Container*		c;
+		std::size_t		i;
+
+	public:
+		index_iterator() : c(0), i(0) {}
+
+		index_iterator(Container* container, std::size_t index) : c(container), i(index) {}
+
+		//iterator to const_iterator
+		template <class C, class R, class P>
+		index_iterator(const index_iterator<C, Value, R, P>& other) : c(other.container()), i(other.index()) {}
+
+		Container*		container() const { return c; }
+
+		std::size_t		index() const { return i; }
+
+		reference	operator*() const { return (*c)[i]; }
+
+		pointer		operator->() const { return &(*c)[i]; }
+
+		reference	operator[](difference_type n) const { return (*c)[i + n]; }
+
+		index_iterator&	operator++() { ++i; return *this; }
+
+		index_iterator&	operator--() { --i; return *this; }
+
+		index_iterator	operator++(int) { index_iterator tmp(*this); ++i; return tmp; }
+
+		index_iterator	operator--(int) { index_iterator tmp(*this); --i; return tmp; }
+
+		index_iterator&	operator+=(difference_type n) { i += n; return *this; }
+
+		index_iterator&	operator-=(difference_type n) { i -= n; return *this; }
+
+		index_iterator	operator+(difference_type n) const { return index_iterator(c, i + n); }
+
+		index_iterator	operator-(difference_type n) const { return index_iterator(c, i - n); }
+
+		template <class C, class R, class P>
+		difference_type	operator-(const index_iterator<C, Value, R, P>& x) const
+		{ return static_cast<difference_type>(i) - static_cast<difference_type>(x.index()); }
+
+		template <class C, class R, class P>
+		bool	operator==(const index_iterator<C, Value, R, P>& x) const { return i == x.index(); }
+
+		template <class C, class R, class P>
+		bool	operator!=(const index_iterator<C, Value, R, P>& x) const { return i != x.index(); }
+
+		template <class C, class R, class P>
+		bool	operator<(const index_iterator<C, Value, R, P>& x) const { return i < x.index(); }
+
+		template <class C, class R, class P>
+		bool	operator>(const index_iterator<C, Value, R, P>& x) const { return i > x.index(); }
+
+		template <class C, class R, class P>
+		bool	operator<=(const index_iterator<C, Value, R, P>& x) const { return i <= x.index(); }
+
+		template <class C, class R, class P>
+		bool	operator>=(const index_iterator<C, Value, R, P>& x) const { return i >= x.index(); }
+	};
+
+	template <class C, class V, class R, class P>
+	inline index_iterator<C, V, R, P>	operator+(std::ptrdiff_t n, const index_iterator<C, V, R, P>& it)
+	{ return it + n; }
+}
+
+#endif //_INDEX_ITERATOR_HPP_
@@ -2,6 +2,7 @@
 #define _ITERATOR_TRAITS_HPP_
 
 #include <cstddef> //ptrdiff_t
+#include <iterator> //std tags and std::iterator_traits
 
 namespace ft
 {
@@ -36,6 +37,58 @@ namespace ft
 		typedef ptrdiff_t										difference_type;
 		typedef std::random_access_iterator_tag								iterator_category;
 	};
+
+	//Maps the std and ft tags onto the ft hierarchy, so algorithms can
+	//dispatch on any iterator: pointers and ft::random_access_iterator carry
+	//std tags, the tree iterators carry ft ones.
+	template <class Tag> struct normalize_category							{ typedef input_iterator_tag type; };
+	template <> struct normalize_category<forward_iterator_tag>				{ typedef forward_iterator_tag type; };
+	template <> struct normalize_category<bidirectional_iterator_tag>		{ typedef bidirectional_iterator_tag type; };
+	template <> struct normalize_category<random_access_iterator_tag>		{ typedef random_access_iterator_tag type; };
+	template <> struct normalize_category<std::forward_iterator_tag>		{ typedef forward_iterator_tag type; };
+	template <> struct normalize_category<std::bidirectional_iterator_tag>	{ typedef bidirectional_iterator_tag type; };
+	template <> struct normalize_category<std::random_access_iterator_tag>	{ typedef random_access_iterator_tag type; };
+
+	//std::iterator_traits, since std iterators lack the const_pointer ft's need
+	template <class Iterator>
+	struct iterator_category_of {
+		typedef typename normalize_category<typename std::iterator_traits<Iterator>::iterator_category>::type	type;
+	};
+
+	template <class InputIt>
+	inline ptrdiff_t	distance(InputIt first, InputIt last, input_iterator_tag)
+	{
+		ptrdiff_t n = 0;
+
+		for (; first != last; ++first)
+			++n;
+		return n;
+	}
+
+	template <class InputIt>
+	inline ptrdiff_t	distance(InputIt first, InputIt last, random_access_iterator_tag)
+	{ return last - first; }
+
+	//O(1) for random access iterators, one walk otherwise
+	template <class InputIt>
+	inline ptrdiff_t	distance(InputIt first, InputIt last)
+	{ return ft::distance(first, last, typename iterator_category_of<InputIt>::type()); }
+
+	template <class InputIt>
+	inline void	advance(InputIt& it, ptrdiff_t n, input_iterator_tag)
+	{
+		for (; n > 0; --n)
+			++it;
+	}
+
+	template <class InputIt>
+	inline void	advance(InputIt& it, ptrdiff_t n, random_access_iterator_tag)
+	{ it += n; }
+
+	//moves it forward by n
+	template <class InputIt>
+	inline void	advance(InputIt& it, ptrdiff_t n)
+	{ ft::advance(it, n, typename iterator_category_of<InputIt>::type()); }
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,201 @@
+#ifndef _MEMORY_HPP_
+#define _MEMORY_HPP_
+
+#include <cstring> // memcpy, memmove
+#include <cstddef>
+#include <new>
+
+#include "type_traits.hpp"
+#include "iterator.hpp"
+#include "fill.hpp"
+
+namespace ft
+{
+	//Allocators with a reallocate(p, old_n, new_n, used) member that resizes a
+	//block and moves its first used elements bytewise. Containers call it in
+	//place of allocate + relocate + deallocate when T is trivially relocatable.
+	template <class Alloc> struct allocator_can_reallocate : public ft::false_type {};
+
+	//------| destruction |--------
+
+	template <class T, class Alloc>
+	inline void	destroy(T*, T*, Alloc&, ft::true_type) {}
+
+	template <class T, class Alloc>
+	inline void	destroy(T* first, T* last, Alloc& alloc, ft::false_type)
+	{
+		for (; first != last; ++first)
+			alloc.destroy(first);
+	}
+
+	//destroys [first, last), which is a no-op for trivially copyable T
+	template <class T, class Alloc>
+	inline void	destroy(T* first, T* last, Alloc& alloc)
+	{ ft::destroy(first, last, alloc, typename ft::is_trivially_copyable<T>::type()); }
+
+	//------| copy construction |--------
+
+	template <class T, class Alloc>
+	inline T*	uninitialized_copy(const T* first, const T* last, T* dest, Alloc&, ft::true_type)
+	{
+		if (first != last)
+			std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof(T));
+		return dest + (last - first);
+	}
+
+	template <class T, class Alloc>
+	T*	uninitialized_copy(const T* first, const T* last, T* dest, Alloc& alloc, ft::false_type)
+	{
+		T* cur = dest;
+
+		try
+		{
+			for (; first != last; ++first, ++cur)
+				alloc.construct(cur, *first);
+		}
+		catch (...)
+		{
+			ft::destroy(dest, cur, alloc);
+			throw;
+		}
+		return cur;
+	}
+
+	//Copy-constructs [first, last) into raw storage at dest and returns the end
+	//of the copy. If a copy throws, the ones already made are destroyed.
+	template <class InputIt, class T, class Alloc>
+	T*	uninitialized_copy(InputIt first, InputIt last, T* dest, Alloc& alloc)
+	{
+		T* cur = dest;
+
+		try
+		{
+			for (; first != last; ++first, ++cur)
+				alloc.construct(cur, *first);
+		}
+		catch (...)
+		{
+			ft::destroy(dest, cur, alloc);
+			throw;
+		}
+		return cur;
+	}
+
+	//contiguous sources of T take one memcpy when T is trivially copyable
+	template <class T, class Alloc>
+	inline T*	uninitialized_copy(const T* first, const T* last, T* dest, Alloc& alloc)
+	{ return ft::uninitialized_copy(first, last, dest, alloc, typename ft::is_trivially_copyable<T>::type()); }
+
+	template <class T, class Alloc>
+	inline T*	uninitialized_copy(T* first, T* last, T* dest, Alloc& alloc)
+	{ return ft::uninitialized_copy(const_cast<const T*>(first), const_cast<const T*>(last), dest, alloc); }
+
+	template <class T, class Alloc>
+	inline T*	uninitialized_copy(ft::random_access_iterator<const T*> first, ft::random_access_iterator<const T*> last, T* dest, Alloc& alloc)
+	{ return ft::uninitialized_copy(first.base(), last.base(), dest, alloc); }
+
+	template <class T, class Alloc>
+	inline T*	uninitialized_copy(ft::random_access_iterator<T*> first, ft::random_access_iterator<T*> last, T* dest, Alloc& alloc)
+	{ return ft::uninitialized_copy(first.base(), last.base(), dest, alloc); }
+
+	//------| fill construction |--------
+
+	template <class T, class Alloc>
+	inline T*	uninitialized_fill_n(T* dest, size_t count, const T& value, Alloc&, ft::true_type)
+	{
+		ft::fill_trivial(dest, count, value);
+		return dest + count;
+	}
+
+	template <class T, class Alloc>
+	T*	uninitialized_fill_n(T* dest, size_t count, const T& value, Alloc& alloc, ft::false_type)
+	{
+		size_t i = 0;
+
+		try
+		{
+			for (; i < count; ++i)
+				alloc.construct(dest + i, value);
+		}
+		catch (...)
+		{
+			ft::destroy(dest, dest + i, alloc);
+			throw;
+		}
+		return dest + count;
+	}
+
+	//Copy-constructs count copies of value into raw storage at dest and returns
+	//the end of the filled range. If a copy throws, the ones made are destroyed.
+	template <class T, class Alloc>
+	inline T*	uninitialized_fill_n(T* dest, size_t count, const T& value, Alloc& alloc)
+	{ return ft::uninitialized_fill_n(dest, count, value, alloc, typename ft::is_trivially_copyable<T>::type()); }
+
+	//------| default construction |--------
+
+	template <class T, class Alloc>
+	inline T*	uninitialized_default_construct(T*, T* last, Alloc&, ft::true_type)
+	{ return last; }
+
+	template <class T, class Alloc>
+	T*	uninitialized_default_construct(T* first, T* last, Alloc& alloc, ft::false_type)
+	{
+		T* cur = first;
+
+		try
+		{
+			for (; cur != last; ++cur)
+				::new (static_cast<void*>(cur)) T;
+		}
+		catch (...)
+		{
+			ft::destroy(first, cur, alloc);
+			throw;
+		}
+		return last;
+	}
+
+	//Default-initializes [first, last): trivial types are left with whatever
+	//bytes the storage holds, others get their default constructor.
+	template <class T, class Alloc>
+	inline T*	uninitialized_default_construct(T* first, T* last, Alloc& alloc)
+	{ return ft::uninitialized_default_construct(first, last, alloc, typename ft::is_trivially_default_constructible<T>::type()); }
+
+	//------| relocation |--------
+
+	template <class T, class Alloc>
+	inline T*	uninitialized_relocate(T* first, T* last, T* dest, Alloc&, ft::true_type)
+	{
+		if (first != last)
+			std::memcpy(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof(T));
+		return dest + (last - first);
+	}
+
+	template <class T, class Alloc>
+	inline T*	uninitialized_relocate(T* first, T* last, T* dest, Alloc& alloc, ft::false_type)
+	{
+		T* end = ft::uninitialized_copy(const_cast<const T*>(first), const_cast<const T*>(last), dest, alloc);
+
+		ft::destroy(first, last, alloc);
+		return end;
+	}
+
+	//Moves [first, last) to raw storage at dest, which must not overlap it, and
+	//leaves the source as raw storage. Trivially relocatable types take one
+	//memcpy; other types are copy-constructed and then destroyed, so a throwing
+	//copy leaves the source untouched.
+	template <class T, class Alloc>
+	inline T*	uninitialized_relocate(T* first, T* last, T* dest, Alloc& alloc)
+	{ return ft::uninitialized_relocate(first, last, dest, alloc, typename ft::is_trivially_relocatable<T>::type()); }
+
+	//Moves [first, last) to dest with one memmove, so the ranges may overlap.
+	//Only for trivially relocatable T; slots left behind become raw storage.
+	template <class T>
+	inline void	relocate_bytes(T* first, T* last, T* dest)
+	{
+		if (first != last && first != dest)
+			std::memmove(static_cast<void*>(dest), static_cast<const void*>(first), (last - first) * sizeof(T));
+	}
+}
+
+#endif //_MEMORY_HPP_
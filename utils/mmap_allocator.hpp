@@ -0,0 +1,181 @@
+/*
+ * ft::mmap_allocator<T>
+ * ---------------------
+ * An allocator that gives large blocks their own anonymous memory mapping,
+ * so they can later be resized by the kernel instead of by copying.
+ *
+ * Features:
+ *   - Blocks of at least MMAP_ALLOCATOR_THRESHOLD bytes (default 2 MiB) are
+ *     mmap()ed, smaller ones come from operator new
+ *   - reallocate() grows or shrinks a mapped block with
+ *     mremap(MREMAP_MAYMOVE): pages are remapped, no byte is copied, and a
+ *     shrink hands the tail pages back to the kernel
+ *   - ft::vector uses reallocate() for trivially relocatable T
+ *   - mmap_allocator_stats() counts the bytes remapped instead of copied
+ *
+ * Example Usage:
+ *   ft::vector<Buffer, ft::mmap_allocator<Buffer> > v;
+ *   for (int i = 0; i < COUNT; i++)
+ *       v.push_back(Buffer());
+ *   std::cout << ft::mmap_allocator_stats().bytes_remapped << std::endl;
+ *
+ * Notes:
+ *   - Off Linux every block comes from operator new and reallocate() copies.
+ */
+#ifndef _MMAP_ALLOCATOR_HPP_
+#define _MMAP_ALLOCATOR_HPP_
+
+#include <cstddef>
+#include <cstring>
+#include <new>
+#include <limits>
+
+#if defined(__linux__)
+# include <sys/mman.h>
+# include <unistd.h>
+#endif
+
+#include "atomic.hpp"
+#include "memory.hpp"
+
+#ifndef MMAP_ALLOCATOR_THRESHOLD
+# define MMAP_ALLOCATOR_THRESHOLD (2UL << 20)
+#endif
+
+namespace ft
+{
+	struct mmap_allocator_counters
+	{
+		ft::atomic<size_t>	remaps;			//reallocations done by mremap
+		ft::atomic<size_t>	bytes_remapped;	//bytes those remaps would have copied
+		ft::atomic<size_t>	copies;			//reallocations that had to copy
+		ft::atomic<size_t>	bytes_copied;
+	};
+
+	//process-wide counters shared by every mmap_allocator
+	inline mmap_allocator_counters&	mmap_allocator_stats()
+	{
+		static mmap_allocator_counters counters;
+		return counters;
+	}
+
+	template <class T>
+	class mmap_allocator
+	{
+	public:
+		typedef T				value_type;
+		typedef T*				pointer;
+		typedef const T*		const_pointer;
+		typedef T&				reference;
+		typedef const T&		const_reference;
+		typedef std::size_t		size_type;
+		typedef std::ptrdiff_t	difference_type;
+
+		template <class U>
+		struct rebind { typedef mmap_allocator<U> other; };
+
+		mmap_allocator() {}
+		mmap_allocator(const mmap_allocator&) {}
+		template <class U>
+		mmap_allocator(const mmap_allocator<U>&) {}
+		~mmap_allocator() {}
+
+		pointer			address(reference x) const { return &x; }
+		const_pointer	address(const_reference x) const { return &x; }
+
+		size_type	max_size() const { return std::numeric_limits<size_type>::max() / sizeof(T); }
+
+		void	construct(pointer p, const T& value) { ::new (static_cast<void*>(p)) T(value); }
+		void	destroy(pointer p) { p->~T(); }
+
+		pointer	allocate(size_type n, const void* = 0)
+		{
+			if (n > max_size())
+				throw std::bad_alloc();
+#if defined(__linux__)
+			if (isMapped(n))
+			{
+				void* p = mmap(NULL, mappedBytes(n), PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+				if (p == MAP_FAILED)
+					throw std::bad_alloc();
+				return static_cast<pointer>(p);
+			}
+#endif
+			return static_cast<pointer>(::operator new(n * sizeof(T)));
+		}
+
+		void	deallocate(pointer p, size_type n)
+		{
+#if defined(__linux__)
+			if (isMapped(n))
+			{
+				munmap(p, mappedBytes(n));
+				return;
+			}
+#endif
+			::operator delete(p);
+		}
+
+		//Resizes the block p of old_n elements to new_n elements, keeping the
+		//bytes of its first used elements. Contents are moved bytewise, so T
+		//must be trivially relocatable. If p is left in place or moved by the
+		//kernel no byte is copied; p is invalid once this returns.
+		pointer	reallocate(pointer p, size_type old_n, size_type new_n, size_type used)
+		{
+			mmap_allocator_counters& stats = mmap_allocator_stats();
+
+#if defined(__linux__)
+			if (isMapped(old_n) && isMapped(new_n))
+			{
+				void* q = mremap(p, mappedBytes(old_n), mappedBytes(new_n), MREMAP_MAYMOVE);
+				if (q == MAP_FAILED)
+					throw std::bad_alloc();
+				stats.remaps.fetch_add(1, ft::memory_order_relaxed);
+				stats.bytes_remapped.fetch_add(used * sizeof(T), ft::memory_order_relaxed);
+				return static_cast<pointer>(q);
+			}
+#endif
+			pointer q = allocate(new_n);
+
+			if (used > new_n)
+				used = new_n;
+			if (used)
+				std::memcpy(static_cast<void*>(q), static_cast<const void*>(p), used * sizeof(T));
+			deallocate(p, old_n);
+			stats.copies.fetch_add(1, ft::memory_order_relaxed);
+			stats.bytes_copied.fetch_add(used * sizeof(T), ft::memory_order_relaxed);
+			return q;
+		}
+
+	private:
+
+		static bool	isMapped(size_type n)
+		{
+#if defined(__linux__)
+			return n * sizeof(T) >= MMAP_ALLOCATOR_THRESHOLD;
+#else
+			(void)n;
+			return false;
+#endif
+		}
+
+#if defined(__linux__)
+		static size_t	mappedBytes(size_type n)
+		{
+			static const size_t page = sysconf(_SC_PAGESIZE);
+
+			return (n * sizeof(T) + page - 1) / page * page;
+		}
+#endif
+	};
+
+	template <class T, class U>
+	inline bool	operator==(const mmap_allocator<T>&, const mmap_allocator<U>&) { return true; }
+
+	template <class T, class U>
+	inline bool	operator!=(const mmap_allocator<T>&, const mmap_allocator<U>&) { return false; }
+
+	template <class T> struct allocator_can_reallocate<mmap_allocator<T> > : public ft::true_type {};
+}
+
+#endif //_MMAP_ALLOCATOR_HPP_
@@ -0,0 +1,40 @@
+#ifndef _MUTEX_HPP_
+#define _MUTEX_HPP_
+
+#include <pthread.h>
+
+namespace ft
+{
+	//pthread mutex with the std::mutex member names (C++98 has no <mutex>)
+	class mutex
+	{
+	private:
+		pthread_mutex_t	handle;
+
+		mutex(const mutex&);
+		mutex& operator=(const mutex&);
+
+	public:
+		mutex() { pthread_mutex_init(&handle, NULL); }
+		~mutex() { pthread_mutex_destroy(&handle); }
+
+		void	lock() { pthread_mutex_lock(&handle); }
+		void	unlock() { pthread_mutex_unlock(&handle); }
+	};
+
+	template<class Mutex>
+	class lock_guard
+	{
+	private:
+		Mutex&	m;
+
+		lock_guard(const lock_guard&);
+		lock_guard& operator=(const lock_guard&);
+
+	public:
+		explicit lock_guard(Mutex& mtx) : m(mtx) { m.lock(); }
+		~lock_guard() { m.unlock(); }
+	};
+}
+
+#endif //_MUTEX_HPP_
@@ -22,7 +22,9 @@ namespace ft
             explicit reverse_iterator(iterator_type ptr) : ptr(ptr) { }
 
             template<typename Iter>
-            reverse_iterator(reverse_iterator<Iter> const &rev_it) : ptr(rev_it.ptr) { }
+            reverse_iterator(reverse_iterator<Iter> const &rev_it) : ptr(rev_it.base()) { }
+
+            iterator_type base() const { return ptr; }
 
             reverse_iterator& operator=(const reverse_iterator<Iterator> &rev_it) {
                 if(this != &rev_it)
@@ -83,41 +85,50 @@ namespace ft
                 return *(*this + n);
             }
 
-
-
-            template <typename It1, typename It2>
-            friend bool operator==(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
-                return lhs.ptr == rhs.ptr;
-            }
-
-            template <typename It1, typename It2>
-            friend bool operator!=(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
-                return !(lhs.ptr == rhs.ptr);
-            }
-
-            template <typename It1, typename It2>
-            friend bool operator<(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
-                return lhs.ptr > rhs.ptr;
-            }
-
-            template <typename It1, typename It2>
-            friend bool operator<=(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
-                return lhs.ptr >= rhs.ptr;
-            }
-
-            template <typename It1, typename It2>
-            friend bool operator>(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
-                return lhs.ptr < rhs.ptr;
-            }
-
-            template <typename It1, typename It2>
-            friend bool operator>=(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
-                return lhs.ptr <= rhs.ptr;
-            }
-        
         private:
             iterator_type ptr;
     };
+
+    //non-members, so every instantiation shares one template of each
+    template <typename It1, typename It2>
+    bool operator==(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
+        return lhs.base() == rhs.base();
+    }
+
+    template <typename It1, typename It2>
+    bool operator!=(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
+        return lhs.base() != rhs.base();
+    }
+
+    template <typename It1, typename It2>
+    bool operator<(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
+        return lhs.base() > rhs.base();
+    }
+
+    template <typename It1, typename It2>
+    bool operator<=(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
+        return lhs.base() >= rhs.base();
+    }
+
+    template <typename It1, typename It2>
+    bool operator>(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
+        return lhs.base() < rhs.base();
+    }
+
+    template <typename It1, typename It2>
+    bool operator>=(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
+        return lhs.base() <= rhs.base();
+    }
+
+    template <typename It1, typename It2>
+    typename reverse_iterator<It1>::difference_type operator-(const reverse_iterator<It1>& lhs, const reverse_iterator<It2>& rhs) {
+        return rhs.base() - lhs.base();
+    }
+
+    template <typename It>
+    reverse_iterator<It> operator+(typename reverse_iterator<It>::difference_type n, const reverse_iterator<It>& it) {
+        return it + n;
+    }
 }
 
 #endif
\ No newline at end of file
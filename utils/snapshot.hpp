@@ -0,0 +1,481 @@
+/*
+ * ft::snapshot
+ * ------------
+ * A binary file format for ft::vector, ft::set and ft::map of trivially
+ * copyable types, written as whole columns and read back without parsing.
+ *
+ * Features:
+ *   - write_snapshot() sends a vector as a header and its data() block in
+ *     one writev(), with no per-element work; the block is contiguous in
+ *     the file, so it can also go out with sendfile()
+ *   - Sets are written as one sorted column of keys, maps as a column of
+ *     keys followed by a column of mapped values
+ *   - ft::snapshot maps a file, or attach()es to memory the caller mapped
+ *     or read, checks its header, and returns the columns as ft::span views into it
+ *   - load_snapshot() copies a vector column with one memcpy, and rebuilds
+ *     sets and maps with assign_sorted(): O(n), no descent, no comparison
+ *   - A 64-bit checksum of the columns is stored in the header and checked
+ *     when a snapshot is opened
+ *
+ * Example Usage:
+ *   ft::map<int, double> prices;
+ *   ...
+ *   ft::save_snapshot("prices.snap", prices);
+ *   ...
+ *   ft::snapshot snap("prices.snap");
+ *   ft::span<const int> ids = snap.keys<int>();        // no copy
+ *   ft::map<int, double> again;
+ *   ft::load_snapshot(snap, again);                    // linear rebuild
+ *
+ * Notes:
+ *   - POSIX only. Every failure throws std::runtime_error.
+ *   - The file is a 64 byte header, then the first column, padded to a
+ *     multiple of 64 bytes, then the second column if there is one. It is
+ *     in the machine's byte order and the types' layout; the header records
+ *     sizeof of the element types and opening with other sizes throws.
+ *   - Passing verify = false skips the checksum, so opening a mapped file
+ *     reads no page of it until a column is used.
+ *   - A map or set must be loaded into a container with the same ordering
+ *     as the one that was saved.
+ *   - Spans into an ft::snapshot are valid until it is closed.
+ */
+#ifndef _SNAPSHOT_HPP_
+#define _SNAPSHOT_HPP_
+
+#include <stdexcept>
+#include <string>
+#include <cstring>
+#include <cerrno>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <sys/uio.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "span.hpp"
+#include "type_traits.hpp"
+#include "utility.hpp"
+#include "../vector/vector.hpp"
+#include "../map/map.hpp"
+#include "../set/set.hpp"
+
+namespace ft
+{
+	enum snapshot_kind { snapshot_vector = 1, snapshot_set = 2, snapshot_map = 3 };
+
+	//first 64 bytes of a snapshot file
+	struct snapshot_header
+	{
+		char				magic[8];
+		unsigned int		version;
+		unsigned int		kind;
+		unsigned int		first_size;		//sizeof of the elements or keys
+		unsigned int		second_size;	//sizeof of the mapped values, or 0
+		unsigned long long	count;
+		unsigned long long	bytes;			//length of the columns and padding
+		unsigned long long	checksum;		//of the columns
+		char				reserved[16];
+	};
+
+	//Fletcher-style sums over 8 byte words: one add per word for each sum,
+	//so it runs at memory speed. A partial last word is zero-padded.
+	class snapshot_checksum
+	{
+		unsigned long long	a;
+		unsigned long long	b;
+
+	public:
+		snapshot_checksum() : a(1), b(0) {}
+
+		void update(const void* data, size_t bytes)
+		{
+			const char*			p = static_cast<const char*>(data);
+			unsigned long long	w;
+
+			for (; bytes >= sizeof(w); p += sizeof(w), bytes -= sizeof(w))
+			{
+				std::memcpy(&w, p, sizeof(w));
+				a += w;
+				b += a;
+			}
+			if (bytes)
+			{
+				w = 0;
+				std::memcpy(&w, p, bytes);
+				a += w;
+				b += a;
+			}
+		}
+
+		unsigned long long value() const { return a ^ (b * 0x9E3779B97F4A7C15ULL); }
+	};
+
+	namespace snapshot_detail
+	{
+		enum { header_bytes = 64, column_alignment = 64 };
+
+		static const unsigned int format_version = 1;
+
+		inline size_t padded(size_t bytes)
+		{
+			return (bytes + column_alignment - 1) & ~size_t(column_alignment - 1);
+		}
+
+		inline void fail(const std::string& what)
+		{
+			throw std::runtime_error("snapshot: " + what + ": " + std::strerror(errno));
+		}
+
+		inline snapshot_header make_header(snapshot_kind kind, size_t first_size, size_t second_size, size_t count,
+			const void* first, const void* second)
+		{
+			snapshot_header		h;
+			snapshot_checksum	sum;
+
+			std::memset(&h, 0, sizeof(h));
+			std::memcpy(h.magic, "ftsnap\0\0", 8);
+			h.version = format_version;
+			h.kind = kind;
+			h.first_size = static_cast<unsigned int>(first_size);
+			h.second_size = static_cast<unsigned int>(second_size);
+			h.count = count;
+			h.bytes = second_size ? padded(count * first_size) + count * second_size : count * first_size;
+			sum.update(first, count * first_size);
+			if (second_size)
+				sum.update(second, count * second_size);
+			h.checksum = sum.value();
+			return h;
+		}
+
+		//fails to compile for types that cannot be written as raw bytes
+		template <class T>
+		inline void require_trivially_copyable()
+		{
+			typedef char T_must_be_trivially_copyable[ft::is_trivially_copyable<T>::value ? 1 : -1];
+
+			(void)sizeof(T_must_be_trivially_copyable);
+		}
+
+		//writev() until every buffer is out, picking up after short writes
+		inline void write_all(int fd, struct iovec* iov, int count)
+		{
+			while (count)
+			{
+				ssize_t n = ::writev(fd, iov, count);
+
+				if (n < 0)
+				{
+					if (errno == EINTR)
+						continue;
+					fail("writev");
+				}
+				for (; count && static_cast<size_t>(n) >= iov->iov_len; ++iov, --count)
+					n -= iov->iov_len;
+				if (count)
+				{
+					iov->iov_base = static_cast<char*>(iov->iov_base) + n;
+					iov->iov_len -= n;
+				}
+			}
+		}
+
+		//header, first column, padding, second column
+		inline void write_columns(int fd, const snapshot_header& h, const void* first, const void* second)
+		{
+			static const char	zeros[column_alignment] = {};
+			size_t				first_bytes = h.count * h.first_size;
+			struct iovec		iov[4];
+			int					count = 2;
+
+			iov[0].iov_base = const_cast<snapshot_header*>(&h);
+			iov[0].iov_len = sizeof(h);
+			iov[1].iov_base = const_cast<void*>(first);
+			iov[1].iov_len = first_bytes;
+			if (h.second_size)
+			{
+				iov[2].iov_base = const_cast<char*>(zeros);
+				iov[2].iov_len = padded(first_bytes) - first_bytes;
+				iov[3].iov_base = const_cast<void*>(second);
+				iov[3].iov_len = h.count * h.second_size;
+				count = 4;
+			}
+			write_all(fd, iov, count);
+		}
+
+		//walks a key column and a value column in step, yielding pairs
+		template <class K, class T>
+		class column_pair_iterator
+		{
+			const K*	key;
+			const T*	value;
+
+		public:
+			column_pair_iterator(const K* k, const T* v) : key(k), value(v) {}
+
+			ft::pair<K, T>			operator*() const { return ft::pair<K, T>(*key, *value); }
+
+			column_pair_iterator&	operator++() { ++key; ++value; return *this; }
+		};
+	}
+
+	//-------------| Writing |-------
+
+	template <class T, class A, class G>
+	void write_snapshot(int fd, const ft::vector<T, A, G>& v)
+	{
+		snapshot_detail::require_trivially_copyable<T>();
+
+		snapshot_header h = snapshot_detail::make_header(snapshot_vector, sizeof(T), 0, v.size(), v.data(), 0);
+
+		snapshot_detail::write_columns(fd, h, v.data(), 0);
+	}
+
+	template <class Key, class Compare, class Alloc>
+	void write_snapshot(int fd, const ft::set<Key, Compare, Alloc>& s)
+	{
+		snapshot_detail::require_trivially_copyable<Key>();
+
+		ft::vector<Key>	keys(s.begin(), s.end());
+		snapshot_header	h = snapshot_detail::make_header(snapshot_set, sizeof(Key), 0, keys.size(), keys.data(), 0);
+
+		snapshot_detail::write_columns(fd, h, keys.data(), 0);
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	void write_snapshot(int fd, const ft::map<Key, T, Compare, Alloc>& m)
+	{
+		snapshot_detail::require_trivially_copyable<Key>();
+		snapshot_detail::require_trivially_copyable<T>();
+
+		ft::vector<Key>	keys;
+		ft::vector<T>	values;
+
+		keys.reserve(m.size());
+		values.reserve(m.size());
+		for (typename ft::map<Key, T, Compare, Alloc>::const_iterator it = m.begin(); it != m.end(); ++it)
+		{
+			keys.push_back(it->first);
+			values.push_back(it->second);
+		}
+
+		snapshot_header h = snapshot_detail::make_header(snapshot_map, sizeof(Key), sizeof(T), keys.size(),
+			keys.data(), values.data());
+
+		snapshot_detail::write_columns(fd, h, keys.data(), values.data());
+	}
+
+	//creates or truncates path and writes the snapshot of c to it
+	template <class Container>
+	void save_snapshot(const char* path, const Container& c)
+	{
+		int fd = ::open(path, O_WRONLY | O_CREAT | O_TRUNC, 0644);
+
+		if (fd < 0)
+			snapshot_detail::fail(path);
+		try {
+			write_snapshot(fd, c);
+		}
+		catch (...) {
+			::close(fd);
+			throw;
+		}
+		if (::close(fd) < 0)
+			snapshot_detail::fail(path);
+	}
+
+	//-------------| Reading |-------
+
+	class snapshot
+	{
+		const char*		base;
+		size_t			length;
+		bool			mapped; // base was mmap()ed by open()
+
+		snapshot(const snapshot&);
+		snapshot& operator=(const snapshot&);
+
+	public:
+
+		snapshot() : base(0), length(0), mapped(false) {}
+
+		explicit snapshot(const char* path, bool verify = true) : base(0), length(0), mapped(false) {
+			open(path, verify);
+		}
+
+		~snapshot() {
+			close();
+		}
+
+		void open(const char* path, bool verify = true) {
+			struct stat	st;
+			int			fd;
+			void*		p;
+
+			close();
+			fd = ::open(path, O_RDONLY);
+			if (fd < 0)
+				snapshot_detail::fail(path);
+			if (fstat(fd, &st) < 0)
+			{
+				::close(fd);
+				snapshot_detail::fail(path);
+			}
+			if (st.st_size < snapshot_detail::header_bytes)
+			{
+				::close(fd);
+				throw std::runtime_error(std::string("snapshot: ") + path + ": not a snapshot file");
+			}
+			p = mmap(NULL, static_cast<size_t>(st.st_size), PROT_READ, MAP_PRIVATE, fd, 0);
+			::close(fd);
+			if (p == MAP_FAILED)
+				snapshot_detail::fail(path);
+			base = static_cast<const char*>(p);
+			length = static_cast<size_t>(st.st_size);
+			mapped = true;
+			try {
+				check(verify);
+			}
+			catch (...) {
+				close();
+				throw;
+			}
+		}
+
+		//Reads a snapshot that is already in memory. The region is not copied
+		//and must outlive the snapshot.
+		void attach(const void* data, size_t bytes, bool verify = true) {
+			close();
+			base = static_cast<const char*>(data);
+			length = bytes;
+			try {
+				check(verify);
+			}
+			catch (...) {
+				close();
+				throw;
+			}
+		}
+
+		void close() {
+			if (mapped)
+				munmap(const_cast<char*>(base), length);
+			base = 0;
+			length = 0;
+			mapped = false;
+		}
+
+		bool					is_open() const { return base != 0; }
+
+		const snapshot_header&	header() const { return *reinterpret_cast<const snapshot_header*>(base); }
+
+		snapshot_kind			kind() const { return static_cast<snapshot_kind>(header().kind); }
+
+		size_t					size() const { return static_cast<size_t>(header().count); }
+
+		//recomputes the checksum of the columns
+		bool verify() const {
+			const snapshot_header&	h = header();
+			snapshot_checksum		sum;
+
+			sum.update(first(), h.count * h.first_size);
+			if (h.second_size)
+				sum.update(second(), h.count * h.second_size);
+			return sum.value() == h.checksum;
+		}
+
+		//the elements of a vector snapshot, or the keys of a set or map one
+		template <class T>
+		ft::span<const T> elements() const {
+			return column<T>(first(), header().first_size);
+		}
+
+		template <class K>
+		ft::span<const K> keys() const {
+			return elements<K>();
+		}
+
+		//the mapped values of a map snapshot, in key order
+		template <class T>
+		ft::span<const T> values() const {
+			if (kind() != snapshot_map)
+				throw std::runtime_error("snapshot: not a map snapshot");
+			return column<T>(second(), header().second_size);
+		}
+
+	private:
+
+		const char*	first() const { return base + snapshot_detail::header_bytes; }
+
+		const char*	second() const {
+			return first() + snapshot_detail::padded(static_cast<size_t>(header().count * header().first_size));
+		}
+
+		template <class T>
+		ft::span<const T> column(const char* p, unsigned int element_size) const {
+			if (element_size != sizeof(T))
+				throw std::runtime_error("snapshot: element size mismatch");
+			if (reinterpret_cast<size_t>(p) % __alignof__(T))
+				throw std::runtime_error("snapshot: misaligned column");
+			return ft::span<const T>(reinterpret_cast<const T*>(p), size());
+		}
+
+		//The header must describe exactly the columns that follow it. The
+		//sizes are checked before they are multiplied so a corrupt count
+		//cannot overflow.
+		void check(bool verify) const {
+			if (length < snapshot_detail::header_bytes)
+				throw std::runtime_error("snapshot: not a snapshot file");
+
+			const snapshot_header&	h = header();
+			unsigned long long		room = length - snapshot_detail::header_bytes;
+
+			if (std::memcmp(h.magic, "ftsnap\0\0", 8) != 0)
+				throw std::runtime_error("snapshot: not a snapshot file");
+			if (h.version != snapshot_detail::format_version)
+				throw std::runtime_error("snapshot: unsupported version");
+			if (h.kind < snapshot_vector || h.kind > snapshot_map || h.first_size == 0
+				|| (h.kind == snapshot_map) != (h.second_size != 0))
+				throw std::runtime_error("snapshot: corrupt header");
+			if (h.count > room / (static_cast<unsigned long long>(h.first_size) + h.second_size)
+				|| h.bytes != (h.second_size ? snapshot_detail::padded(h.count * h.first_size) + h.count * h.second_size
+												: h.count * h.first_size)
+				|| h.bytes > room)
+				throw std::runtime_error("snapshot: truncated");
+			if (verify && !this->verify())
+				throw std::runtime_error("snapshot: checksum mismatch");
+		}
+	};
+
+	//-------------| Loading |-------
+
+	template <class T, class A, class G>
+	void load_snapshot(const snapshot& snap, ft::vector<T, A, G>& out)
+	{
+		if (snap.kind() != snapshot_vector)
+			throw std::runtime_error("snapshot: not a vector snapshot");
+
+		ft::span<const T> data = snap.elements<T>();
+
+		out.assign(data.begin(), data.end());
+	}
+
+	template <class Key, class Compare, class Alloc>
+	void load_snapshot(const snapshot& snap, ft::set<Key, Compare, Alloc>& out)
+	{
+		if (snap.kind() != snapshot_set)
+			throw std::runtime_error("snapshot: not a set snapshot");
+		out.assign_sorted(snap.keys<Key>().begin(), snap.size());
+	}
+
+	template <class Key, class T, class Compare, class Alloc>
+	void load_snapshot(const snapshot& snap, ft::map<Key, T, Compare, Alloc>& out)
+	{
+		ft::span<const T>	values = snap.values<T>();
+		ft::span<const Key>	keys = snap.keys<Key>();
+
+		out.assign_sorted(snapshot_detail::column_pair_iterator<Key, T>(keys.begin(), values.begin()), snap.size());
+	}
+}
+
+#endif //_SNAPSHOT_HPP_
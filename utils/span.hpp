@@ -0,0 +1,50 @@
+#ifndef _SPAN_HPP_
+#define _SPAN_HPP_
+
+#include <cstddef>
+
+namespace ft
+{
+	//A view of count contiguous elements owned by someone else. It is a
+	//plain pointer and length, so loops over it compile down to pointer
+	//arithmetic the compiler can vectorize. T may be const.
+	template <class T>
+	class span
+	{
+	public:
+		typedef T				element_type;
+		typedef T*				pointer;
+		typedef T&				reference;
+		typedef T*				iterator;
+		typedef std::size_t		size_type;
+
+	private:
+		pointer		ptr;
+		size_type	count;
+
+	public:
+		span() : ptr(0), count(0) {}
+
+		span(pointer p, size_type n) : ptr(p), count(n) {}
+
+		//span<T> to span<const T>
+		template <class U>
+		span(const span<U>& other) : ptr(other.data()), count(other.size()) {}
+
+		pointer		data() const { return ptr; }
+
+		size_type	size() const { return count; }
+
+		bool		empty() const { return count == 0; }
+
+		iterator	begin() const { return ptr; }
+
+		iterator	end() const { return ptr + count; }
+
+		reference	operator[](size_type i) const { return ptr[i]; }
+
+		span		subspan(size_type offset, size_type n) const { return span(ptr + offset, n); }
+	};
+}
+
+#endif //_SPAN_HPP_
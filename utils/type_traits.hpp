@@ -5,6 +5,19 @@
 #ifndef _TYPE_TRAITS_HPP_
 #define _TYPE_TRAITS_HPP_
 
+#include <string>
+
+//__has_trivial_constructor is deprecated since clang 15, which warns about
+//it by default; compilers that have the standard trait's builtin use that.
+#if defined(__has_builtin)
+# if __has_builtin(__is_trivially_constructible)
+#  define FT_TRIVIALLY_DEFAULT_CONSTRUCTIBLE(T) __is_trivially_constructible(T)
+# endif
+#endif
+#ifndef FT_TRIVIALLY_DEFAULT_CONSTRUCTIBLE
+# define FT_TRIVIALLY_DEFAULT_CONSTRUCTIBLE(T) __has_trivial_constructor(T)
+#endif
+
 namespace ft
 {
 	template<bool B, class T = void>
@@ -21,6 +34,9 @@ namespace ft
 		operator value_type() const { return value; }
 	};
 
+	typedef integral_constant<bool, true>	true_type;
+	typedef integral_constant<bool, false>	false_type;
+
 	template <class T> struct is_integral : public ft::integral_constant<T, false> {};
 	template <> struct is_integral<bool> : public ft::integral_constant<bool, true> {};
 	template <> struct is_integral<char> : public ft::integral_constant<bool, true> {};
@@ -37,6 +53,33 @@ namespace ft
 	template <> struct is_integral<long long> : public integral_constant<bool, true> {};
 	template <> struct is_integral<unsigned long long> : public integral_constant<bool, true> {};
 
+	//Types that can be copied with memcpy. C++98 has no such trait, so this
+	//relies on the compiler builtin GCC and Clang provide in every mode.
+	template <class T> struct is_trivially_copyable : public integral_constant<bool, __is_trivially_copyable(T)> {};
+
+	//Types whose default constructor does nothing, so default-initialized
+	//objects of them need no constructor call at all.
+	template <class T> struct is_trivially_default_constructible : public integral_constant<bool, FT_TRIVIALLY_DEFAULT_CONSTRUCTIBLE(T)> {};
+
+	//Types whose objects may be moved to new storage by copying their bytes
+	//and simply forgetting the old copy, without running a constructor or a
+	//destructor. Every trivially copyable type qualifies; specialize it to
+	//true_type for other types that hold no pointer into themselves.
+	template <class T> struct is_trivially_relocatable : public integral_constant<bool, is_trivially_copyable<T>::value> {};
+
+	//Containers give the strong guarantee by default: a throwing copy leaves
+	//them as they were. For types that are not trivially relocatable that can
+	//cost a fresh block on every middle insert; specialize this to true_type
+	//to let them shift elements in place and settle for the basic guarantee.
+	template <class T> struct basic_exception_guarantee : public false_type {};
+
+	//Types whose swap, std::swap or one found by argument-dependent lookup,
+	//never throws. Containers shift such elements in place by swapping and
+	//keep the strong guarantee without a fresh block. Specialize it to
+	//true_type for other types with a non-throwing swap.
+	template <class T> struct is_nothrow_swappable : public integral_constant<bool, is_trivially_copyable<T>::value> {};
+	template <class C, class Tr, class A> struct is_nothrow_swappable<std::basic_string<C, Tr, A> > : public true_type {};
+
 }
 
 
@@ -0,0 +1,291 @@
+/*
+ * ft::concurrent_vector<T, Allocator>
+ * -----------------------------------
+ * An append-only vector that many threads can push_back to and read from at
+ * once without a lock.
+ *
+ * Template Parameters:
+ *   - T: Type of elements.
+ *   - Allocator: Memory allocator, used from several threads at once
+ *     (default: std::allocator<T>).
+ *
+ * Features:
+ *   - push_back claims its slot with one atomic fetch_add, then constructs
+ *     the element there without holding anything
+ *   - Segmented storage: segment k holds first_segment << k elements and is
+ *     never moved or freed while the vector lives, so elements never move
+ *   - Each segment is allocated exactly once: the first thread to need it
+ *     allocates, and the others wait for it instead of racing
+ *   - Every slot has a publish flag, set with release order once its
+ *     element is constructed; readers test it with published(i)
+ *   - Indexing is O(1): a bit scan finds the segment
+ *
+ * Example Usage:
+ *   ft::concurrent_vector<Event> events;   // shared by every thread
+ *   size_t i = events.push_back(e);        // from any producer
+ *   if (events.published(j))               // from any reader
+ *       handle(events[j]);
+ *
+ * Methods:
+ *   - Constructors: default
+ *   - get_allocator
+ *   - at, operator[], published
+ *   - begin, end
+ *   - empty, size, max_size
+ *   - push_back, clear
+ *
+ * Notes:
+ *   - The vector cannot be copied, and elements cannot be erased.
+ *   - size() counts claimed slots, which may not be published yet. Read an
+ *     element only after published(i) returned true, or once the producers
+ *     have stopped; at() throws std::out_of_range for unpublished slots.
+ *   - If copying the value throws, push_back rethrows and its slot stays
+ *     unpublished for good. The same goes for a push that has to allocate
+ *     a segment and fails; the next push into that segment tries again.
+ *   - Iterators and clear() are for when no producer is running.
+ */
+#ifndef _CONCURRENT_VECTOR_HPP_
+#define _CONCURRENT_VECTOR_HPP_
+
+
+#include <stdexcept>
+#include <new>
+#include <sched.h>
+
+#include "../utils/atomic.hpp"
+#include "../utils/index_iterator.hpp"
+#include "../utils/type_traits.hpp"
+
+
+namespace ft {
+	template < class T, class A = std::allocator<T> >
+	class concurrent_vector
+	{
+	public:
+
+		typedef T															value_type;
+		typedef A															allocator_type;
+		typedef std::size_t 												size_type;
+		typedef std::ptrdiff_t												difference_type;
+		typedef value_type&													reference;
+		typedef const value_type&											const_reference;
+		typedef T*															pointer;
+		typedef const T*													const_pointer;
+		typedef ft::index_iterator<concurrent_vector, T, T&, T*>			iterator;
+		typedef ft::index_iterator<const concurrent_vector, T, const T&, const T*>	const_iterator;
+
+		static const size_type												first_segment = 64;
+
+	private:
+
+		enum { first_shift = 6, max_segments = 64 - first_shift };
+
+		typedef typename A::template rebind<char>::other					byte_allocator;
+		typedef ft::atomic<unsigned char>									flag;
+
+		//A segment is one block: its elements, then one publish flag per
+		//element. A directory slot is 0, installing() while one thread
+		//allocates the segment, then the block for good.
+		ft::atomic<size_type>								_size; // slots handed out
+		char												_pad[64]; // keeps the contended counter off the directory's line
+		ft::atomic<char*>									_segments[max_segments];
+		allocator_type										allocator;
+
+		concurrent_vector(const concurrent_vector&);
+		concurrent_vector& operator=(const concurrent_vector&);
+
+	public:
+
+		explicit concurrent_vector(const A& alloc = A()) : _size(0), allocator(alloc) {}
+
+		//no other thread may use the vector any more
+		~concurrent_vector() {
+			clear();
+		};
+
+		allocator_type get_allocator() const { return this->allocator; };
+
+		//-------------| Element access |-------
+
+		//true once the element at pos is constructed and visible to this thread
+		bool published(size_type pos) const {
+			size_type	k;
+			size_type	off;
+
+			locate(pos, k, off);
+			if (k >= max_segments)
+				return false;
+
+			char* block = _segments[k].load(ft::memory_order_acquire);
+
+			return block && block != installing() && flags(block, k)[off].load(ft::memory_order_acquire) != 0;
+		};
+
+		reference at(size_type pos) {
+			if (!published(pos))
+				throw std::out_of_range("concurrent_vector");
+			return (*this)[pos];
+		};
+
+		const_reference at(size_type pos) const {
+			if (!published(pos))
+				throw std::out_of_range("concurrent_vector");
+			return (*this)[pos];
+		};
+
+		reference operator[](size_type pos) {
+			size_type	k;
+			size_type	off;
+
+			locate(pos, k, off);
+			return elements(_segments[k].load(ft::memory_order_acquire))[off];
+		};
+
+		const_reference operator[](size_type pos) const {
+			size_type	k;
+			size_type	off;
+
+			locate(pos, k, off);
+			return elements(_segments[k].load(ft::memory_order_acquire))[off];
+		};
+
+		//-------------| Iterator FUNCTIONS |-------
+
+		iterator				begin() 								{ return iterator(this, 0); };
+		const_iterator			begin() const 							{ return const_iterator(this, 0); };
+		iterator				end() 									{ return iterator(this, size()); };
+		const_iterator			end() const 							{ return const_iterator(this, size()); };
+
+		//-------------| Capacity |-------
+
+		bool					empty() const 							{ return size() == 0; };
+		size_type				size() const 							{ return _size.load(ft::memory_order_acquire); };
+		size_type				max_size() const 						{ return (~size_type(0) >> 1) / (sizeof(T) + 1); };
+
+		//-------------| Modifiers |-------
+
+		//Safe to call from any number of threads at once; returns the index
+		//the value was stored at.
+		size_type push_back(const_reference value) {
+			size_type	pos = _size.fetch_add(1, ft::memory_order_relaxed);
+			size_type	k;
+			size_type	off;
+
+			locate(pos, k, off);
+			if (k >= max_segments)
+				throw std::length_error("concurrent_vector");
+
+			char* block = segment(k);
+
+			allocator.construct(elements(block) + off, value);
+			flags(block, k)[off].store(1, ft::memory_order_release);
+			return pos;
+		};
+
+		//destroys every published element and frees the segments; no other
+		//thread may use the vector meanwhile
+		void clear() {
+			byte_allocator	bytes(allocator);
+
+			for (size_type k = 0; k < max_segments; ++k)
+			{
+				char* block = _segments[k].load(ft::memory_order_acquire);
+
+				if (block == 0)
+					continue;
+				destroy_published(block, k, typename ft::is_trivially_copyable<T>::type());
+				bytes.deallocate(block, segment_bytes(k));
+				_segments[k].store(0, ft::memory_order_relaxed);
+			}
+			_size.store(0, ft::memory_order_release);
+		};
+
+	private:
+
+		static size_type segment_length(size_type k) {
+			return size_type(first_segment) << k;
+		}
+
+		static size_type segment_bytes(size_type k) {
+			return segment_length(k) * (sizeof(T) + sizeof(flag));
+		}
+
+		static pointer elements(char* block) {
+			return reinterpret_cast<pointer>(block);
+		}
+
+		static flag* flags(char* block, size_type k) {
+			return reinterpret_cast<flag*>(block + segment_length(k) * sizeof(T));
+		}
+
+		//Segment k starts at index first_segment * (2^k - 1), so pos +
+		//first_segment has its highest bit at position k + first_shift.
+		static void locate(size_type pos, size_type& k, size_type& off) {
+			unsigned long long x = static_cast<unsigned long long>(pos) + first_segment;
+			size_type high = 63 - __builtin_clzll(x);
+
+			k = high - first_shift;
+			off = static_cast<size_type>(x - (static_cast<unsigned long long>(first_segment) << k));
+		}
+
+		//marks a directory slot whose segment is being allocated
+		static char* installing() {
+			static char mark;
+			return &mark;
+		}
+
+		//The first thread to find segment k missing claims its slot and
+		//allocates it; the others yield until it is there, so a contended
+		//boundary costs one allocation, not one per thread. A failed
+		//allocation frees the slot again for the next thread to retry.
+		char* segment(size_type k) {
+			for (;;)
+			{
+				char* block = _segments[k].load(ft::memory_order_acquire);
+
+				if (block == 0)
+				{
+					if (_segments[k].compare_exchange_strong(block, installing(), ft::memory_order_acq_rel))
+						return install_segment(k);
+					continue;
+				}
+				if (block != installing())
+					return block;
+				sched_yield();
+			}
+		}
+
+		char* install_segment(size_type k) {
+			byte_allocator	bytes(allocator);
+			char*			block;
+
+			try { block = bytes.allocate(segment_bytes(k)); }
+			catch (...) {
+				_segments[k].store(0, ft::memory_order_release);
+				throw;
+			}
+
+			flag* f = flags(block, k);
+
+			for (size_type i = 0; i < segment_length(k); ++i)
+				::new (static_cast<void*>(f + i)) flag(0);
+			_segments[k].store(block, ft::memory_order_release);
+			return block;
+		}
+
+		void destroy_published(char*, size_type, ft::true_type) {}
+
+		void destroy_published(char* block, size_type k, ft::false_type) {
+			flag* f = flags(block, k);
+
+			for (size_type i = 0; i < segment_length(k); ++i)
+				if (f[i].load(ft::memory_order_relaxed))
+					allocator.destroy(elements(block) + i);
+		}
+	};
+
+	template <class T, class A>
+	const typename concurrent_vector<T, A>::size_type concurrent_vector<T, A>::first_segment;
+}
+
+#endif //_CONCURRENT_VECTOR_HPP_
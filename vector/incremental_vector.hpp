@@ -0,0 +1,374 @@
+/*
+ * ft::incremental_vector<T, Allocator, Growth, Step>
+ * --------------------------------------------------
+ * A vector that spreads the cost of growing over the push_backs that follow
+ * it, so no single call has to copy the whole array.
+ *
+ * Template Parameters:
+ *   - T: Type of elements.
+ *   - Allocator: Memory allocator (default: std::allocator<T>).
+ *   - Growth: Growth policy (default: ft::growth_double), see
+ *     utils/growth_policy.hpp.
+ *   - Step: Elements migrated per push_back (default: 4).
+ *
+ * Features:
+ *   - Growth only allocates the new block; the elements stay in the old one
+ *     and each later push_back moves at most Step of them, so every
+ *     push_back does O(1) work apart from the allocation itself
+ *   - Both blocks stay readable during a migration: operator[], at and the
+ *     iterators find every element in whichever block holds it
+ *   - Migration moves with memcpy for trivially relocatable T
+ *
+ * Example Usage:
+ *   ft::incremental_vector<Sample> v;
+ *   for (;;)
+ *       v.push_back(next_sample());  // never copies more than 4 elements
+ *
+ * Methods:
+ *   - Constructors: default, fill, range, copy
+ *   - operator=
+ *   - at, operator[], front, back, data
+ *   - begin, end, rbegin, rend
+ *   - empty, size, capacity, max_size, migrating
+ *   - reserve, finish_migration, clear, push_back, pop_back, resize, swap
+ *   - Comparison operators
+ *
+ * Notes:
+ *   - Throws std::out_of_range on invalid access in at().
+ *   - A migration ends before the new block fills up as long as
+ *     Step * (growth factor - 1) >= 1, which holds for every built-in
+ *     policy. Growing during a migration finishes it first.
+ *   - reserve() also migrates incrementally.
+ *   - data() needs one contiguous block, so it finishes the migration.
+ *   - Element access tests which block holds the index, so it costs a
+ *     compare more than ft::vector.
+ *   - Iterators hold an index, so they stay valid across growth.
+ */
+#ifndef _INCREMENTAL_VECTOR_HPP_
+#define _INCREMENTAL_VECTOR_HPP_
+
+
+#include <stdexcept>
+
+#include "../utils/index_iterator.hpp"
+#include "../utils/reverse_iterator.hpp"
+#include "../utils/type_traits.hpp"
+#include "../utils/algorithm.hpp"
+#include "../utils/memory.hpp"
+#include "../utils/growth_policy.hpp"
+
+
+namespace ft {
+	template < class T, class A = std::allocator<T>, class G = ft::growth_double, std::size_t Step = 4 >
+	class incremental_vector
+	{
+	public:
+
+		typedef T															value_type;
+		typedef A															allocator_type;
+		typedef G															growth_policy;
+		typedef std::size_t 												size_type;
+		typedef std::ptrdiff_t												difference_type;
+		typedef value_type&													reference;
+		typedef const value_type&											const_reference;
+		typedef T*															pointer;
+		typedef const T*													const_pointer;
+		typedef ft::index_iterator<incremental_vector, T, T&, T*>			iterator;
+		typedef ft::index_iterator<const incremental_vector, T, const T&, const T*>	const_iterator;
+		typedef ft::reverse_iterator<iterator> 								reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>						const_reverse_iterator;
+
+		static const size_type												migration_step = Step;
+
+	private:
+
+		//Elements [0, _pending) are still in _old, the rest are in buffer.
+		//Migration moves them down from the top, so one compare finds an index.
+		pointer												buffer;
+		size_type 											_capacity;
+		size_type 											_size;
+		pointer												_old;
+		size_type											_old_capacity;
+		size_type											_pending;
+		allocator_type										allocator;
+
+	public:
+
+		explicit incremental_vector(const A& alloc = A())
+		: buffer(0), _capacity(0), _size(0), _old(0), _old_capacity(0), _pending(0), allocator(alloc) {}
+
+		incremental_vector(size_type count, const_reference value = value_type(), const A& alloc = A())
+		: buffer(0), _capacity(0), _size(0), _old(0), _old_capacity(0), _pending(0), allocator(alloc) {
+			if (count == 0)
+				return;
+			buffer = allocator.allocate(count);
+			try { ft::uninitialized_fill_n(buffer, count, value, allocator); }
+			catch (...) {
+				allocator.deallocate(buffer, count);
+				throw;
+			}
+			_capacity = count;
+			_size = count;
+		};
+
+		template <class InputIterator>
+		incremental_vector(InputIterator first, InputIterator last, const A& alloc = A(),
+			   typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0)
+		: buffer(0), _capacity(0), _size(0), _old(0), _old_capacity(0), _pending(0), allocator(alloc) {
+			try {
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+			catch (...) {
+				clear();
+				release_storage();
+				throw;
+			}
+		};
+
+		//the copy is contiguous even if other is migrating
+		incremental_vector(const incremental_vector& other)
+		: buffer(0), _capacity(0), _size(0), _old(0), _old_capacity(0), _pending(0), allocator(other.allocator) {
+			if (other._size == 0)
+				return;
+			const_pointer	old = other._old;
+			const_pointer	cur = other.buffer;
+
+			buffer = allocator.allocate(other._size);
+			try {
+				ft::uninitialized_copy(old, old + other._pending, buffer, allocator);
+				try { ft::uninitialized_copy(cur + other._pending, cur + other._size, buffer + other._pending, allocator); }
+				catch (...) {
+					ft::destroy(buffer, buffer + other._pending, allocator);
+					throw;
+				}
+			}
+			catch (...) {
+				allocator.deallocate(buffer, other._size);
+				throw;
+			}
+			_capacity = other._size;
+			_size = other._size;
+		};
+
+		~incremental_vector() {
+			clear();
+			release_storage();
+		};
+
+		incremental_vector& operator=(const incremental_vector& other) {
+			if (this != &other)
+			{
+				incremental_vector tmp(other);
+				swap(tmp);
+			}
+			return *this;
+		};
+
+		allocator_type get_allocator() const { return this->allocator; };
+
+		//-------------| Element access |-------
+
+		reference at(size_type pos) {
+			if (pos >= _size)
+				throw std::out_of_range("incremental_vector");
+			return (*this)[pos];
+		};
+
+		const_reference at(size_type pos) const {
+			if (pos >= _size)
+				throw std::out_of_range("incremental_vector");
+			return (*this)[pos];
+		};
+
+		reference				operator[](size_type pos) 				{ return pos < _pending ? _old[pos] : buffer[pos]; };
+		const_reference			operator[](size_type pos) const 		{ return pos < _pending ? _old[pos] : buffer[pos]; };
+		reference				front() 								{ return (*this)[0]; };
+		const_reference			front() const 							{ return (*this)[0]; };
+		reference				back() 									{ return (*this)[_size - 1]; };
+		const_reference			back() const 							{ return (*this)[_size - 1]; };
+
+		//finishes a pending migration, so this may move up to size() elements
+		pointer					data() 									{ finish_migration(); return buffer; };
+
+		//-------------| Iterator FUNCTIONS |-------
+
+		iterator				begin() 								{ return iterator(this, 0); };
+		const_iterator			begin() const 							{ return const_iterator(this, 0); };
+		iterator				end() 									{ return iterator(this, _size); };
+		const_iterator			end() const 							{ return const_iterator(this, _size); };
+		reverse_iterator		rbegin() 								{ return reverse_iterator(end()); };
+		const_reverse_iterator	rbegin() const 							{ return const_reverse_iterator(end()); };
+		reverse_iterator		rend() 									{ return reverse_iterator(begin()); };
+		const_reverse_iterator	rend() const 							{ return const_reverse_iterator(begin()); };
+
+		//-------------| Capacity |-------
+
+		bool					empty() const 							{ return _size == 0; };
+		size_type				size() const 							{ return _size; };
+		size_type				max_size() const 						{ return allocator.max_size(); };
+		size_type				capacity() const 						{ return _capacity; };
+		bool					migrating() const 						{ return _old != 0; };
+
+		void reserve(size_type size) {
+			if (size > _capacity)
+				start_migration(size);
+		};
+
+		void finish_migration() {
+			migrate(_pending);
+		};
+
+		//-------------| Modifiers |-------
+
+		void clear() {
+			ft::destroy(_old, _old + _pending, allocator);
+			ft::destroy(buffer + _pending, buffer + _size, allocator);
+			release_old();
+			_size = 0;
+		};
+
+		//A throwing migration step undoes the push, so the vector is left as
+		//it was.
+		void push_back(const_reference value) {
+			if (_size == _capacity)
+			{
+				value_type copy(value); // value may be in the block a pending migration frees
+
+				start_migration(recommend(_size + 1));
+				allocator.construct(buffer + _size, copy);
+			}
+			else
+				allocator.construct(buffer + _size, value);
+			++_size;
+			try { migrate(Step); }
+			catch (...) {
+				--_size;
+				allocator.destroy(buffer + _size);
+				throw;
+			}
+		};
+
+		void pop_back() {
+			--_size;
+			if (_size >= _pending)
+				allocator.destroy(buffer + _size);
+			else
+			{
+				allocator.destroy(_old + _size);
+				_pending = _size;
+				if (_pending == 0)
+					release_old();
+			}
+		};
+
+		void resize(size_type count, value_type value = value_type()) {
+			while (_size > count)
+				pop_back();
+			while (_size < count)
+				push_back(value);
+		};
+
+		void swap(incremental_vector& other) {
+			std::swap(buffer, other.buffer);
+			std::swap(_capacity, other._capacity);
+			std::swap(_size, other._size);
+			std::swap(_old, other._old);
+			std::swap(_old_capacity, other._old_capacity);
+			std::swap(_pending, other._pending);
+			std::swap(allocator, other.allocator);
+		};
+
+	private:
+
+		//capacity the growth policy picks to hold required elements
+		size_type recommend(size_type required) const {
+			return G::grow(_capacity, required, sizeof(T));
+		}
+
+		//Allocates the new block and leaves every element where it is. Only
+		//one migration runs at a time, so a pending one is finished first.
+		void start_migration(size_type new_cap) {
+			finish_migration();
+
+			pointer tmp = allocator.allocate(new_cap);
+
+			_old = buffer;
+			_old_capacity = _capacity;
+			_pending = _size;
+			buffer = tmp;
+			_capacity = new_cap;
+			if (_pending == 0)
+				release_old();
+		}
+
+		//moves the top count elements still in the old block, and frees it
+		//once it is empty
+		void migrate(size_type count) {
+			if (_pending == 0)
+				return;
+			if (count > _pending)
+				count = _pending;
+			ft::uninitialized_relocate(_old + _pending - count, _old + _pending, buffer + _pending - count, allocator);
+			_pending -= count;
+			if (_pending == 0)
+				release_old();
+		}
+
+		void release_old() {
+			if (_old)
+				allocator.deallocate(_old, _old_capacity);
+			_old = 0;
+			_old_capacity = 0;
+			_pending = 0;
+		}
+
+		void release_storage() {
+			release_old();
+			if (buffer)
+				allocator.deallocate(buffer, _capacity);
+			buffer = 0;
+			_capacity = 0;
+		}
+	};
+
+	template <class T, class A, class G, std::size_t S>
+	const typename incremental_vector<T, A, G, S>::size_type incremental_vector<T, A, G, S>::migration_step;
+
+	template <class T, class A, class G, std::size_t S>
+	bool operator==(const ft::incremental_vector<T, A, G, S>& lhs, const ft::incremental_vector<T, A, G, S>& rhs) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template <class T, class A, class G, std::size_t S>
+	bool operator!=(const ft::incremental_vector<T, A, G, S>& lhs, const ft::incremental_vector<T, A, G, S>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template <class T, class A, class G, std::size_t S>
+	bool operator<(const ft::incremental_vector<T, A, G, S>& lhs, const ft::incremental_vector<T, A, G, S>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template <class T, class A, class G, std::size_t S>
+	bool operator<=(const ft::incremental_vector<T, A, G, S>& lhs, const ft::incremental_vector<T, A, G, S>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template <class T, class A, class G, std::size_t S>
+	bool operator>(const ft::incremental_vector<T, A, G, S>& lhs, const ft::incremental_vector<T, A, G, S>& rhs) {
+		return rhs < lhs;
+	}
+
+	template <class T, class A, class G, std::size_t S>
+	bool operator>=(const ft::incremental_vector<T, A, G, S>& lhs, const ft::incremental_vector<T, A, G, S>& rhs) {
+		return !(lhs < rhs);
+	}
+
+	template <class T, class A, class G, std::size_t S>
+	void swap(ft::incremental_vector<T, A, G, S>& lhs, ft::incremental_vector<T, A, G, S>& rhs) {
+		lhs.swap(rhs);
+	}
+}
+
+#endif //_INCREMENTAL_VECTOR_HPP_
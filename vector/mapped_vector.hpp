@@ -0,0 +1,375 @@
+/*
+ * ft::mapped_vector<T, Growth>
+ * ----------------------------
+ * A vector of trivially copyable elements that lives in a memory-mapped
+ * file, so it survives the process and reopens without reading anything.
+ *
+ * Template Parameters:
+ *   - T: Type of elements, trivially copyable.
+ *   - Growth: Growth policy (default: ft::growth_double), see
+ *     utils/growth_policy.hpp.
+ *
+ * Features:
+ *   - open() maps the file and checks its header in O(1); pages are read
+ *     from disk the first time they are touched
+ *   - Growth extends the file with ftruncate and remaps it (mremap on
+ *     Linux), so elements are never copied
+ *   - sync() writes dirty pages back with msync, as a checkpoint
+ *   - Elements are contiguous: data(), pointer iterators, memcpy-able
+ *
+ * Example Usage:
+ *   ft::mapped_vector<Row> table("rows.bin");  // created if missing
+ *   table.push_back(row);
+ *   table.sync();                              // durable from here on
+ *   ...
+ *   ft::mapped_vector<Row> again("rows.bin", ft::mapped_vector<Row>::read_only);
+ *
+ * Methods:
+ *   - Constructors: default, from a path and mode
+ *   - open, close, is_open, sync
+ *   - at, operator[], front, back, data
+ *   - begin, end, rbegin, rend
+ *   - empty, size, capacity, max_size
+ *   - reserve, clear, push_back, pop_back, resize, append, swap
+ *
+ * Notes:
+ *   - POSIX only. The file starts with a 64 byte header holding a magic
+ *     number, a format version, sizeof(T) and the element count; opening a
+ *     file whose header does not match throws std::runtime_error.
+ *   - The file is in the machine's byte order and T's layout.
+ *   - Modifying a vector opened read_only throws std::runtime_error.
+ *   - Growing may move the mapping, which invalidates pointers, references
+ *     and iterators, as in ft::vector.
+ *   - Without sync(), changes reach the disk whenever the kernel writes
+ *     the pages back; close() and the destructor do not sync.
+ *   - The vector cannot be copied.
+ */
+#ifndef _MAPPED_VECTOR_HPP_
+#define _MAPPED_VECTOR_HPP_
+
+
+#include <stdexcept>
+#include <string>
+#include <cstring>
+#include <cerrno>
+#include <algorithm>
+
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+
+#include "../utils/iterator.hpp"
+#include "../utils/reverse_iterator.hpp"
+#include "../utils/type_traits.hpp"
+#include "../utils/growth_policy.hpp"
+
+
+namespace ft {
+	//first 64 bytes of a mapped_vector file
+	struct mapped_vector_header
+	{
+		char				magic[8];
+		unsigned int		version;
+		unsigned int		element_size;
+		unsigned long long	size;
+		char				reserved[40];
+	};
+
+	template < class T, class G = ft::growth_double >
+	class mapped_vector
+	{
+	public:
+
+		typedef T											value_type;
+		typedef G											growth_policy;
+		typedef std::size_t 								size_type;
+		typedef std::ptrdiff_t								difference_type;
+		typedef value_type&									reference;
+		typedef const value_type&							const_reference;
+		typedef T*											pointer;
+		typedef const T*									const_pointer;
+		typedef ft::random_access_iterator<T*> 				iterator;
+		typedef ft::random_access_iterator<const T*>		const_iterator;
+		typedef ft::reverse_iterator<iterator> 				reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+		enum open_mode { read_only, read_write };
+
+		static const unsigned int							format_version = 1;
+
+	private:
+
+		typedef char T_must_be_trivially_copyable[ft::is_trivially_copyable<T>::value ? 1 : -1];
+
+		enum { header_bytes = 64 };
+
+		int													fd;
+		bool												writable;
+		char*												map; // header, then the elements
+		size_type											mapped; // bytes
+		size_type 											_capacity;
+
+		mapped_vector(const mapped_vector&);
+		mapped_vector& operator=(const mapped_vector&);
+
+	public:
+
+		mapped_vector() : fd(-1), writable(false), map(0), mapped(0), _capacity(0) {}
+
+		//read_write creates the file if it does not exist
+		explicit mapped_vector(const char* path, open_mode mode = read_write)
+		: fd(-1), writable(false), map(0), mapped(0), _capacity(0) {
+			open(path, mode);
+		};
+
+		~mapped_vector() {
+			close();
+		};
+
+		void open(const char* path, open_mode mode = read_write) {
+			struct stat	st;
+
+			close();
+			fd = ::open(path, mode == read_write ? O_RDWR | O_CREAT : O_RDONLY, 0644);
+			if (fd < 0)
+				fail(path);
+			try {
+				if (fstat(fd, &st) < 0)
+					fail(path);
+				writable = mode == read_write;
+				if (st.st_size == 0 && writable)
+					create(path);
+				else
+					attach(path, static_cast<size_type>(st.st_size));
+			}
+			catch (...) {
+				close();
+				throw;
+			}
+		};
+
+		//unmaps the file; the data stays in it
+		void close() {
+			if (map)
+				munmap(map, mapped);
+			if (fd >= 0)
+				::close(fd);
+			fd = -1;
+			writable = false;
+			map = 0;
+			mapped = 0;
+			_capacity = 0;
+		};
+
+		bool is_open() const { return map != 0; };
+
+		//Checkpoint: returns once every change so far is on disk. With async
+		//the write-back is only started.
+		void sync(bool async = false) {
+			if (map && writable && msync(map, mapped, async ? MS_ASYNC : MS_SYNC) < 0)
+				fail("msync");
+		};
+
+		//-------------| Element access |-------
+
+		reference at(size_type pos) {
+			if (pos >= size())
+				throw std::out_of_range("mapped_vector");
+			return data()[pos];
+		};
+
+		const_reference at(size_type pos) const {
+			if (pos >= size())
+				throw std::out_of_range("mapped_vector");
+			return data()[pos];
+		};
+
+		reference				operator[](size_type pos) 				{ return data()[pos]; };
+		const_reference			operator[](size_type pos) const 		{ return data()[pos]; };
+		reference				front() 								{ return data()[0]; };
+		const_reference			front() const 							{ return data()[0]; };
+		reference				back() 									{ return data()[size() - 1]; };
+		const_reference			back() const 							{ return data()[size() - 1]; };
+		pointer					data() 									{ return map ? reinterpret_cast<pointer>(map + header_bytes) : 0; };
+		const_pointer			data() const 							{ return map ? reinterpret_cast<const_pointer>(map + header_bytes) : 0; };
+
+		//-------------| Iterator FUNCTIONS |-------
+
+		iterator				begin() 								{ return iterator(data()); };
+		const_iterator			begin() const 							{ return const_iterator(data()); };
+		iterator				end() 									{ return iterator(data() + size()); };
+		const_iterator			end() const 							{ return const_iterator(data() + size()); };
+		reverse_iterator		rbegin() 								{ return reverse_iterator(end()); };
+		const_reverse_iterator	rbegin() const 							{ return const_reverse_iterator(end()); };
+		reverse_iterator		rend() 									{ return reverse_iterator(begin()); };
+		const_reverse_iterator	rend() const 							{ return const_reverse_iterator(begin()); };
+
+		//-------------| Capacity |-------
+
+		bool					empty() const 							{ return size() == 0; };
+		size_type				size() const 							{ return map ? static_cast<size_type>(header()->size) : 0; };
+		size_type				capacity() const 						{ return _capacity; };
+		size_type				max_size() const 						{ return (~size_type(0) >> 1) / sizeof(T); };
+
+		void reserve(size_type size) {
+			check_writable();
+			if (size > _capacity)
+				remap(size);
+		};
+
+		//-------------| Modifiers |-------
+
+		void clear() {
+			check_writable();
+			header()->size = 0;
+		};
+
+		void push_back(const_reference value) {
+			check_writable();
+
+			size_type n = size();
+
+			if (n == _capacity)
+			{
+				value_type copy(value); // value may be in the mapping that moves
+
+				remap(G::grow(_capacity, n + 1, sizeof(T)));
+				data()[n] = copy;
+			}
+			else
+				data()[n] = value;
+			header()->size = n + 1;
+		};
+
+		void pop_back() {
+			check_writable();
+			header()->size = size() - 1;
+		};
+
+		void resize(size_type count, value_type value = value_type()) {
+			check_writable();
+
+			size_type n = size();
+
+			if (count > _capacity)
+				remap(G::grow(_capacity, count, sizeof(T)));
+			for (size_type i = n; i < count; ++i)
+				data()[i] = value;
+			header()->size = count;
+		};
+
+		//copies count elements from ptr, which must not point into this vector
+		void append(const_pointer ptr, size_type count) {
+			check_writable();
+
+			size_type n = size();
+
+			if (n + count > _capacity)
+				remap(G::grow(_capacity, n + count, sizeof(T)));
+			if (count)
+				std::memcpy(static_cast<void*>(data() + n), static_cast<const void*>(ptr), count * sizeof(T));
+			header()->size = n + count;
+		};
+
+		void swap(mapped_vector& other) {
+			std::swap(fd, other.fd);
+			std::swap(writable, other.writable);
+			std::swap(map, other.map);
+			std::swap(mapped, other.mapped);
+			std::swap(_capacity, other._capacity);
+		};
+
+	private:
+
+		mapped_vector_header*		header() 							{ return reinterpret_cast<mapped_vector_header*>(map); }
+		const mapped_vector_header*	header() const 						{ return reinterpret_cast<const mapped_vector_header*>(map); }
+
+		static void fail(const std::string& what) {
+			throw std::runtime_error("mapped_vector: " + what + ": " + std::strerror(errno));
+		}
+
+		void check_writable() const {
+			if (!writable)
+				throw std::runtime_error("mapped_vector: not opened read_write");
+		}
+
+		//an empty file gets a header and no elements
+		void create(const char* path) {
+			if (ftruncate(fd, header_bytes) < 0)
+				fail(path);
+			map_file(path, header_bytes);
+
+			mapped_vector_header* h = header();
+
+			std::memcpy(h->magic, "ftmvec\0\0", 8);
+			h->version = format_version;
+			h->element_size = sizeof(T);
+			h->size = 0;
+		}
+
+		void attach(const char* path, size_type bytes) {
+			if (bytes < header_bytes)
+				throw std::runtime_error(std::string("mapped_vector: ") + path + ": not a mapped_vector file");
+			map_file(path, bytes);
+
+			const mapped_vector_header* h = header();
+
+			if (std::memcmp(h->magic, "ftmvec\0\0", 8) != 0 || h->version != format_version)
+				throw std::runtime_error(std::string("mapped_vector: ") + path + ": not a mapped_vector file");
+			if (h->element_size != sizeof(T))
+				throw std::runtime_error(std::string("mapped_vector: ") + path + ": element size mismatch");
+			if (h->size > _capacity)
+				throw std::runtime_error(std::string("mapped_vector: ") + path + ": truncated");
+		}
+
+		void map_file(const char* path, size_type bytes) {
+			void* p = mmap(NULL, bytes, writable ? PROT_READ | PROT_WRITE : PROT_READ, MAP_SHARED, fd, 0);
+
+			if (p == MAP_FAILED)
+				fail(path);
+			map = static_cast<char*>(p);
+			mapped = bytes;
+			_capacity = (bytes - header_bytes) / sizeof(T);
+		}
+
+		//Extends the file to hold capacity elements and maps the new length.
+		//The kernel keeps the pages, so no element is copied. If mapping
+		//fails the file is cut back to the length still mapped.
+		void remap(size_type capacity) {
+			size_type	bytes = header_bytes + capacity * sizeof(T);
+			void*		p;
+
+			if (ftruncate(fd, static_cast<off_t>(bytes)) < 0)
+				fail("ftruncate");
+#if defined(__linux__)
+			p = mremap(map, mapped, bytes, MREMAP_MAYMOVE);
+#else
+			p = mmap(NULL, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+			if (p != MAP_FAILED)
+				munmap(map, mapped);
+#endif
+			if (p == MAP_FAILED) {
+				int error = errno;
+
+				//best effort: the mremap error is the one worth reporting
+				if (ftruncate(fd, static_cast<off_t>(mapped)) < 0) {}
+				errno = error;
+				fail("mremap");
+			}
+			map = static_cast<char*>(p);
+			mapped = bytes;
+			_capacity = capacity;
+		}
+	};
+
+	template <class T, class G>
+	const unsigned int mapped_vector<T, G>::format_version;
+
+	template <class T, class G>
+	void swap(ft::mapped_vector<T, G>& lhs, ft::mapped_vector<T, G>& rhs) {
+		lhs.swap(rhs);
+	}
+}
+
+#endif //_MAPPED_VECTOR_HPP_
@@ -0,0 +1,356 @@
+/*
+ * ft::segmented_vector<T, Allocator, ChunkSize>
+ * ---------------------------------------------
+ * A vector whose elements live in fixed-size chunks found through a small
+ * directory, so growing it never moves an element.
+ *
+ * Template Parameters:
+ *   - T: Type of elements.
+ *   - Allocator: Memory allocator (default: std::allocator<T>).
+ *   - ChunkSize: Elements per chunk, a power of two (default: as many as fit
+ *     in SEGMENTED_VECTOR_CHUNK_BYTES, 4 KiB).
+ *
+ * Features:
+ *   - O(1) random access: one shift, one mask and one directory load
+ *   - push_back and pop_back never move or copy existing elements, so
+ *     pointers and references stay valid until their element is removed
+ *   - Growth allocates one chunk; only the directory of chunk pointers is
+ *     ever reallocated, which copies size() / ChunkSize pointers
+ *   - Random access iterators, usable with ft::reverse_iterator
+ *
+ * Example Usage:
+ *   ft::segmented_vector<int> v;
+ *   v.push_back(1);
+ *   int* first = &v[0];
+ *   for (int i = 0; i < 1000000; ++i)
+ *       v.push_back(i);         // first still points at v[0]
+ *
+ * Methods:
+ *   - Constructors: default, fill, range, copy
+ *   - operator=, assign
+ *   - at, operator[], front, back
+ *   - begin, end, rbegin, rend
+ *   - empty, size, capacity, max_size
+ *   - reserve, shrink_to_fit, clear, push_back, pop_back, resize, swap
+ *   - Comparison operators
+ *
+ * Notes:
+ *   - Throws std::out_of_range on invalid access in at().
+ *   - Elements are not contiguous across chunks, so there is no data().
+ *   - Chunks are kept when elements are removed; shrink_to_fit() frees the
+ *     ones past the last element.
+ *   - Iterators hold an index, so they stay valid as elements are added.
+ */
+#ifndef _SEGMENTED_VECTOR_HPP_
+#define _SEGMENTED_VECTOR_HPP_
+
+
+#include <stdexcept>
+
+#include "../utils/index_iterator.hpp"
+#include "../utils/reverse_iterator.hpp"
+#include "../utils/type_traits.hpp"
+#include "../utils/algorithm.hpp"
+#include "../utils/memory.hpp"
+#include "vector.hpp"
+
+#ifndef SEGMENTED_VECTOR_CHUNK_BYTES
+# define SEGMENTED_VECTOR_CHUNK_BYTES 4096
+#endif
+
+
+namespace ft {
+	//largest power of two N with N * Size <= Bytes, and at least 1
+	template <std::size_t Size, std::size_t Bytes = SEGMENTED_VECTOR_CHUNK_BYTES,
+			  std::size_t N = 1, bool Fits = (2 * N * Size <= Bytes)>
+	struct segment_length { static const std::size_t value = segment_length<Size, Bytes, 2 * N>::value; };
+
+	template <std::size_t Size, std::size_t Bytes, std::size_t N>
+	struct segment_length<Size, Bytes, N, false> { static const std::size_t value = N; };
+
+	template < class T, class A = std::allocator<T>, std::size_t ChunkSize = ft::segment_length<sizeof(T)>::value >
+	class segmented_vector
+	{
+	public:
+
+		typedef T															value_type;
+		typedef A															allocator_type;
+		typedef std::size_t 												size_type;
+		typedef std::ptrdiff_t												difference_type;
+		typedef value_type&													reference;
+		typedef const value_type&											const_reference;
+		typedef T*															pointer;
+		typedef const T*													const_pointer;
+		typedef ft::index_iterator<segmented_vector, T, T&, T*>				iterator;
+		typedef ft::index_iterator<const segmented_vector, T, const T&, const T*>	const_iterator;
+		typedef ft::reverse_iterator<iterator> 								reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>						const_reverse_iterator;
+
+		static const size_type												chunk_size = ChunkSize;
+
+	private:
+
+		//a power of two turns the index split into a shift and a mask
+		typedef char chunk_size_must_be_a_power_of_two[ChunkSize && (ChunkSize & (ChunkSize - 1)) == 0 ? 1 : -1];
+
+		typedef typename A::template rebind<T*>::other		directory_allocator;
+		typedef ft::vector<T*, directory_allocator>			directory;
+
+		directory											_chunks;
+		size_type 											_size;
+		allocator_type										allocator;
+
+	public:
+
+		explicit segmented_vector(const A& alloc = A()) : _chunks(), _size(0), allocator(alloc) {}
+
+		segmented_vector(size_type count, const_reference value = value_type(), const A& alloc = A())
+		: _chunks(), _size(0), allocator(alloc) {
+			try { append_copies(count, value); }
+			catch (...) { release_all(); throw; }
+		};
+
+		template <class InputIterator>
+		segmented_vector(InputIterator first, InputIterator last, const A& alloc = A(),
+			   typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0)
+		: _chunks(), _size(0), allocator(alloc) {
+			try {
+				for (; first != last; ++first)
+					push_back(*first);
+			}
+			catch (...) { release_all(); throw; }
+		};
+
+		segmented_vector(const segmented_vector& other) : _chunks(), _size(0), allocator(other.allocator) {
+			try { copy_from(other); }
+			catch (...) { release_all(); throw; }
+		};
+
+		~segmented_vector() {
+			release_all();
+		};
+
+		//reuses the chunks this vector already has
+		segmented_vector& operator=(const segmented_vector& other) {
+			if (this != &other)
+			{
+				clear();
+				copy_from(other);
+			}
+			return *this;
+		};
+
+		void assign(size_type count, const_reference value) {
+			value_type copy(value); // value may be one of the elements cleared below
+			clear();
+			append_copies(count, copy);
+		};
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type
+		assign(InputIterator first, InputIterator last) {
+			clear();
+			for (; first != last; ++first)
+				push_back(*first);
+		};
+
+		allocator_type get_allocator() const { return this->allocator; };
+
+		//-------------| Element access |-------
+
+		reference at(size_type pos) {
+			if (pos >= _size)
+				throw std::out_of_range("segmented_vector");
+			return (*this)[pos];
+		};
+
+		const_reference at(size_type pos) const {
+			if (pos >= _size)
+				throw std::out_of_range("segmented_vector");
+			return (*this)[pos];
+		};
+
+		reference				operator[](size_type pos) 				{ return _chunks[pos / ChunkSize][pos % ChunkSize]; };
+		const_reference			operator[](size_type pos) const 		{ return _chunks[pos / ChunkSize][pos % ChunkSize]; };
+		reference				front() 								{ return (*this)[0]; };
+		const_reference			front() const 							{ return (*this)[0]; };
+		reference				back() 									{ return (*this)[_size - 1]; };
+		const_reference			back() const 							{ return (*this)[_size - 1]; };
+
+		//-------------| Iterator FUNCTIONS |-------
+
+		iterator				begin() 								{ return iterator(this, 0); };
+		const_iterator			begin() const 							{ return const_iterator(this, 0); };
+		iterator				end() 									{ return iterator(this, _size); };
+		const_iterator			end() const 							{ return const_iterator(this, _size); };
+		reverse_iterator		rbegin() 								{ return reverse_iterator(end()); };
+		const_reverse_iterator	rbegin() const 							{ return const_reverse_iterator(end()); };
+		reverse_iterator		rend() 									{ return reverse_iterator(begin()); };
+		const_reverse_iterator	rend() const 							{ return const_reverse_iterator(begin()); };
+
+		//-------------| Capacity |-------
+
+		bool					empty() const 							{ return _size == 0; };
+		size_type				size() const 							{ return _size; };
+		size_type				max_size() const 						{ return allocator.max_size(); };
+		size_type				capacity() const 						{ return _chunks.size() * ChunkSize; };
+
+		void reserve(size_type size) {
+			if (size <= capacity())
+				return;
+			_chunks.reserve(chunks_for(size));
+			while (capacity() < size)
+				add_chunk();
+		};
+
+		//frees the chunks past the last element and trims the directory
+		void shrink_to_fit() {
+			release_chunks(chunks_for(_size));
+			_chunks.shrink_to_fit();
+		};
+
+		//-------------| Modifiers |-------
+
+		void clear() {
+			destroy_from(0);
+		};
+
+		void push_back(const_reference value) {
+			if (_size == capacity())
+				add_chunk();
+			allocator.construct(_chunks[_size / ChunkSize] + _size % ChunkSize, value);
+			++_size;
+		};
+
+		void pop_back() {
+			--_size;
+			allocator.destroy(_chunks[_size / ChunkSize] + _size % ChunkSize);
+		};
+
+		void resize(size_type count, value_type value = value_type()) {
+			if (count < _size)
+				destroy_from(count);
+			else
+				append_copies(count - _size, value);
+		};
+
+		void swap(segmented_vector& other) {
+			_chunks.swap(other._chunks);
+			std::swap(_size, other._size);
+			std::swap(allocator, other.allocator);
+		};
+
+	private:
+
+		static size_type chunks_for(size_type count) {
+			return (count + ChunkSize - 1) / ChunkSize;
+		}
+
+		//the directory slot is taken first, so a failed allocation leaks nothing
+		void add_chunk() {
+			_chunks.push_back(0);
+			try { _chunks.back() = allocator.allocate(ChunkSize); }
+			catch (...) {
+				_chunks.pop_back();
+				throw;
+			}
+		}
+
+		//frees every chunk from index keep on, which must all be empty
+		void release_chunks(size_type keep) {
+			while (_chunks.size() > keep)
+			{
+				allocator.deallocate(_chunks.back(), ChunkSize);
+				_chunks.pop_back();
+			}
+		}
+
+		void release_all() {
+			clear();
+			release_chunks(0);
+		}
+
+		//destroys the elements from index from on, one chunk at a time
+		void destroy_from(size_type from) {
+			while (_size > from)
+			{
+				size_type	first = (_size - 1) / ChunkSize * ChunkSize;
+				pointer		chunk = _chunks[first / ChunkSize];
+
+				if (first < from)
+					first = from;
+				ft::destroy(chunk + first % ChunkSize, chunk + (_size - 1) % ChunkSize + 1, allocator);
+				_size = first;
+			}
+		}
+
+		//fills each chunk with one ft::uninitialized_fill_n; value may be an
+		//element, which stays put
+		void append_copies(size_type count, const_reference value) {
+			reserve(_size + count);
+			while (count)
+			{
+				size_type n = ChunkSize - _size % ChunkSize;
+
+				if (n > count)
+					n = count;
+				ft::uninitialized_fill_n(_chunks[_size / ChunkSize] + _size % ChunkSize, n, value, allocator);
+				_size += n;
+				count -= n;
+			}
+		}
+
+		//this vector is empty, so its chunks line up with other's
+		void copy_from(const segmented_vector& other) {
+			reserve(other._size);
+			while (_size < other._size)
+			{
+				size_type		n = other._size - _size < ChunkSize ? other._size - _size : ChunkSize;
+				const_pointer	src = other._chunks[_size / ChunkSize];
+
+				ft::uninitialized_copy(src, src + n, _chunks[_size / ChunkSize], allocator);
+				_size += n;
+			}
+		}
+	};
+
+	template <class T, class A, std::size_t N>
+	const typename segmented_vector<T, A, N>::size_type segmented_vector<T, A, N>::chunk_size;
+
+	template <class T, class A, std::size_t N>
+	bool operator==(const ft::segmented_vector<T, A, N>& lhs, const ft::segmented_vector<T, A, N>& rhs) {
+		return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin());
+	}
+
+	template <class T, class A, std::size_t N>
+	bool operator!=(const ft::segmented_vector<T, A, N>& lhs, const ft::segmented_vector<T, A, N>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template <class T, class A, std::size_t N>
+	bool operator<(const ft::segmented_vector<T, A, N>& lhs, const ft::segmented_vector<T, A, N>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template <class T, class A, std::size_t N>
+	bool operator<=(const ft::segmented_vector<T, A, N>& lhs, const ft::segmented_vector<T, A, N>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template <class T, class A, std::size_t N>
+	bool operator>(const ft::segmented_vector<T, A, N>& lhs, const ft::segmented_vector<T, A, N>& rhs) {
+		return rhs < lhs;
+	}
+
+	template <class T, class A, std::size_t N>
+	bool operator>=(const ft::segmented_vector<T, A, N>& lhs, const ft::segmented_vector<T, A, N>& rhs) {
+		return !(lhs < rhs);
+	}
+
+	template <class T, class A, std::size_t N>
+	void swap(ft::segmented_vector<T, A, N>& lhs, ft::segmented_vector<T, A, N>& rhs) {
+		lhs.swap(rhs);
+	}
+}
+
+#endif //_SEGMENTED_VECTOR_HPP_
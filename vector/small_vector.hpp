@@ -0,0 +1,438 @@
+/*
+ * ft::small_vector<T, N, Allocator, Growth>
+ * -----------------------------------------
+ * A vector that keeps its first N elements inside the object itself and only
+ * goes to the allocator once it needs room for more.
+ *
+ * Template Parameters:
+ *   - T: Type of elements.
+ *   - N: Number of elements stored inline.
+ *   - Allocator: Memory allocator for the spilled storage (default: std::allocator<T>).
+ *   - Growth: Growth policy once spilled (default: ft::growth_double).
+ *
+ * Features:
+ *   - No allocation at all while size() <= N
+ *   - Same interface and iterator types as ft::vector<T, Allocator, Growth>
+ *   - Spilling and growth relocate with one memcpy for trivially
+ *     relocatable T
+ *
+ * Example Usage:
+ *   ft::small_vector<int, 8> v;     // no allocation yet
+ *   for (int i = 0; i < 8; ++i)
+ *       v.push_back(i);             // still none
+ *   v.push_back(8);                 // moves to the heap
+ *
+ * Methods:
+ *   - Constructors: default, fill, range, copy
+ *   - operator=, assign
+ *   - at, operator[], front, back, data
+ *   - begin, end, rbegin, rend
+ *   - empty, size, capacity, max_size
+ *   - reserve, clear, insert, erase, push_back, pop_back, resize, swap
+ *   - Comparison operators
+ *
+ * Notes:
+ *   - capacity() is at least N.
+ *   - Once spilled, the elements stay on the heap until the vector is
+ *     destroyed; clear() does not move them back.
+ *   - swap exchanges heap blocks in O(1) when both sides have spilled and
+ *     copies the elements otherwise, so it can throw.
+ *   - Like ft::vector, insert and erase in the middle shift the tail with
+ *     one memmove for trivially relocatable T. Other types are shifted by
+ *     assignment, so a throwing copy leaves only the basic guarantee.
+ */
+#ifndef _SMALL_VECTOR_HPP_
+#define _SMALL_VECTOR_HPP_
+
+
+#include <stdexcept>
+
+#include "../utils/iterator.hpp"
+#include "../utils/reverse_iterator.hpp"
+#include "../utils/iterator_traits.hpp"
+#include "../utils/utility.hpp"
+#include "../utils/type_traits.hpp"
+#include "../utils/algorithm.hpp"
+#include "../utils/memory.hpp"
+#include "../utils/growth_policy.hpp"
+
+
+namespace ft {
+	template < class T, std::size_t N, class A = std::allocator<T>, class G = ft::growth_double >
+	class small_vector
+	{
+	public:
+
+		typedef T											value_type;
+		typedef A											allocator_type;
+		typedef G											growth_policy;
+		typedef std::size_t 								size_type;
+		typedef std::ptrdiff_t								difference_type;
+		typedef value_type&									reference;
+		typedef const value_type&							const_reference;
+		typedef T*											pointer;
+		typedef const T*									const_pointer;
+		typedef ft::random_access_iterator<T*> 				iterator;
+		typedef ft::random_access_iterator<const T*>		const_iterator;
+		typedef ft::reverse_iterator<iterator> 				reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>		const_reverse_iterator;
+
+		static const size_type								inline_capacity = N;
+
+	private:
+
+		//raw, suitably aligned room for N elements
+		union Inline {
+			char			bytes[N * sizeof(T)];
+			long double		align_ld;
+			long long		align_ll;
+			void*			align_p;
+		};
+
+		typedef typename ft::is_trivially_relocatable<T>::type		relocatable;
+
+		pointer												buffer;
+		size_type 											_capacity;
+		size_type 											_size;
+		allocator_type										allocator;
+		Inline												_inline;
+
+	public:
+
+		explicit small_vector(const A& alloc = A()) : buffer(inline_data()), _capacity(N), _size(0), allocator(alloc) {}
+
+		small_vector(size_type count, const_reference value = value_type(), const A& alloc = A())
+		: buffer(inline_data()), _capacity(N), _size(0), allocator(alloc) {
+			insert(end(), count, value);
+		};
+
+		template <class InputIterator>
+		small_vector(InputIterator first, InputIterator last, const A& alloc = A(),
+			   typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0)
+		: buffer(inline_data()), _capacity(N), _size(0), allocator(alloc) {
+			insert(end(), first, last);
+		};
+
+		small_vector(const small_vector& other) : buffer(inline_data()), _capacity(N), _size(0), allocator(other.allocator) {
+			insert(end(), other.begin(), other.end());
+		};
+
+		~small_vector() {
+			clear();
+			release_storage();
+		};
+
+		small_vector& operator=(const small_vector& other) {
+			if (this != &other)
+				assign(other.begin(), other.end());
+			return *this;
+		};
+
+		void assign(size_type count, const_reference value ) {
+			value_type copy(value); // value may be one of the elements cleared below
+			clear();
+			insert(end(), count, copy);
+		};
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type
+		assign(InputIterator first, InputIterator last) {
+			clear();
+			insert(end(), first, last);
+		};
+
+		allocator_type get_allocator() const { return this->allocator; };
+
+
+		reference at( size_type pos ) {
+			if (pos >= _size)
+				throw std::out_of_range("small_vector");
+			return buffer[pos];
+		};
+
+		const_reference at( size_type pos ) const {
+			if (pos >= _size)
+				throw std::out_of_range("small_vector");
+			return buffer[pos];
+		};
+
+		reference       		operator[]( size_type pos )					{ return buffer[pos]; };
+		const_reference 		operator[]( size_type pos ) const			{ return buffer[pos]; };
+		reference				front()										{ return *buffer; };
+		const_reference 		front() const								{ return *buffer; };
+		reference				back()										{ return buffer[_size - 1]; };
+		const_reference			back() const								{ return buffer[_size - 1]; };
+		pointer 				data()										{ return buffer; };
+		const_pointer			data() const								{ return buffer; };
+		iterator 				begin()										{ return iterator(buffer); };
+		const_iterator 			begin() const								{ return const_iterator(buffer); };
+		iterator 				end()										{ return iterator(buffer + _size); };
+		const_iterator 			end() const									{ return const_iterator(buffer + _size); };
+		reverse_iterator 		rbegin()									{ return reverse_iterator(end()); };
+		const_reverse_iterator 	rbegin() const								{ return const_reverse_iterator(end()); };
+		reverse_iterator 		rend()										{ return reverse_iterator(begin()); };
+		const_reverse_iterator 	rend() const								{ return const_reverse_iterator(begin()); };
+		bool 					empty() const								{ return _size == 0; };
+		size_type				size() const								{ return _size; };
+		size_type				capacity() const							{ return _capacity; };
+		size_type				max_size() const 							{ return allocator.max_size(); };
+
+		//true while the elements live inside the object
+		bool					is_inline() const							{ return buffer == inline_data(); };
+
+
+		void reserve(size_type size) {
+			if (size <= _capacity)
+				return;
+
+			pointer tmp = allocator.allocate(size);
+			try { ft::uninitialized_relocate(buffer, buffer + _size, tmp, allocator); }
+			catch (...) { allocator.deallocate(tmp, size); throw; }
+			release_storage();
+			buffer = tmp;
+			_capacity = size;
+		};
+
+		void clear() {
+			ft::destroy(buffer, buffer + _size, allocator);
+			_size = 0;
+		};
+
+		void insert( iterator pos, size_type count, const T& value ) {
+			size_type index = pos - begin();
+
+			if (count == 0)
+				return;
+			value_type copy(value); // value may live in the storage moved below
+			if (_size + count > _capacity)
+				reserve(recommend(_size + count));
+			fill_gap(index, count, copy, relocatable());
+		};
+
+		iterator insert(iterator pos, const_reference value) {
+			size_type index = pos - begin();
+			this->insert(pos, 1, value);
+			return iterator(buffer + index);
+		};
+
+		template <class InputIt>
+		typename ft::enable_if<!ft::is_integral<InputIt>::value, void>::type
+		insert( iterator pos, InputIt first, InputIt last) {
+			insert_range(pos - begin(), first, last, typename ft::iterator_category_of<InputIt>::type());
+		};
+
+		iterator erase( iterator pos )
+		{
+			return erase(pos, pos + 1);
+		}
+
+		iterator erase( iterator first, iterator last )
+		{
+			pointer from = first.base();
+			pointer to = last.base();
+
+			if (from == to)
+				return first;
+			close_gap(from, to, relocatable());
+			_size -= to - from;
+			return first;
+		}
+
+		void push_back( const_reference value ) {
+			if (_size == _capacity) {
+				value_type copy(value); // value may live in the storage reserve() frees
+				this->reserve(recommend(_size + 1));
+				allocator.construct(buffer + _size, copy);
+			}
+			else
+				allocator.construct(buffer + _size, value);
+			++_size;
+		};
+
+		void pop_back() {
+			_size--;
+			allocator.destroy(buffer + _size);
+		}
+
+		void resize( size_type count, T value = T() ) {
+			if (count < _size)
+				erase(begin() + count, end());
+			else
+				insert(end(), count - _size, value);
+		}
+
+		void swap( small_vector& other ) {
+			if (!is_inline() && !other.is_inline()) {
+				std::swap(buffer, other.buffer);
+				std::swap(_capacity, other._capacity);
+				std::swap(_size, other._size);
+				std::swap(allocator, other.allocator);
+				return;
+			}
+			small_vector tmp(*this);
+			*this = other;
+			other = tmp;
+		}
+
+	private:
+
+		pointer inline_data() const {
+			return reinterpret_cast<pointer>(const_cast<char*>(_inline.bytes));
+		}
+
+		void release_storage() {
+			if (!is_inline())
+				allocator.deallocate(buffer, _capacity);
+		}
+
+		//capacity the growth policy picks to hold required elements
+		size_type recommend(size_type required) const {
+			return G::grow(_capacity, required, sizeof(T));
+		}
+
+		//single pass: the elements cannot be counted before they are read
+		template <class InputIt>
+		void insert_range(size_type index, InputIt first, InputIt last, ft::input_iterator_tag) {
+			if (index == _size) {
+				for (; first != last; ++first)
+					this->push_back(*first);
+				return;
+			}
+			small_vector tmp(first, last, allocator);
+			insert_range(index, tmp.begin(), tmp.end(), ft::forward_iterator_tag());
+		}
+
+		template <class ForwardIt>
+		void insert_range(size_type index, ForwardIt first, ForwardIt last, ft::forward_iterator_tag) {
+			size_type count = ft::distance(first, last);
+
+			if (count == 0)
+				return;
+			if (_size + count > _capacity)
+				reserve(recommend(_size + count));
+			copy_gap(index, first, last, count, relocatable());
+		}
+
+		//Opens count slots at index and fills them with value. Trivially
+		//relocatable tails move with one memmove, and move back on a throw.
+		void fill_gap(size_type index, size_type count, const_reference value, ft::true_type) {
+			pointer gap = buffer + index;
+			ft::relocate_bytes(gap, buffer + _size, gap + count);
+			try { ft::uninitialized_fill_n(gap, count, value, allocator); }
+			catch (...) { ft::relocate_bytes(gap + count, buffer + _size + count, gap); throw; }
+			_size += count;
+		}
+
+		//Other tails are copy-constructed past the end where they land on raw
+		//slots and assigned backwards where they land on live ones.
+		void fill_gap(size_type index, size_type count, const_reference value, ft::false_type) {
+			pointer gap = buffer + index;
+			pointer old_end = buffer + _size;
+			size_type after = _size - index;
+
+			if (after > count) {
+				ft::uninitialized_copy(old_end - count, old_end, old_end, allocator);
+				_size += count;
+				for (pointer src = old_end - count, dst = old_end; src != gap; )
+					*--dst = *--src;
+				for (pointer p = gap; p != gap + count; ++p)
+					*p = value;
+			} else {
+				ft::uninitialized_fill_n(old_end, count - after, value, allocator);
+				_size += count - after;
+				try { ft::uninitialized_copy(gap, old_end, gap + count, allocator); }
+				catch (...) {
+					ft::destroy(old_end, old_end + (count - after), allocator);
+					_size -= count - after;
+					throw;
+				}
+				_size += after;
+				for (pointer p = gap; p != old_end; ++p)
+					*p = value;
+			}
+		}
+
+		//same as fill_gap, with the new elements taken from [first, last)
+		template <class ForwardIt>
+		void copy_gap(size_type index, ForwardIt first, ForwardIt last, size_type count, ft::true_type) {
+			pointer gap = buffer + index;
+			ft::relocate_bytes(gap, buffer + _size, gap + count);
+			try { ft::uninitialized_copy(first, last, gap, allocator); }
+			catch (...) { ft::relocate_bytes(gap + count, buffer + _size + count, gap); throw; }
+			_size += count;
+		}
+
+		template <class ForwardIt>
+		void copy_gap(size_type index, ForwardIt first, ForwardIt last, size_type count, ft::false_type) {
+			pointer gap = buffer + index;
+			pointer old_end = buffer + _size;
+			size_type after = _size - index;
+
+			if (after > count) {
+				ft::uninitialized_copy(old_end - count, old_end, old_end, allocator);
+				_size += count;
+				for (pointer src = old_end - count, dst = old_end; src != gap; )
+					*--dst = *--src;
+				for (pointer p = gap; first != last; ++p, ++first)
+					*p = *first;
+			} else {
+				ForwardIt mid = first;
+				ft::advance(mid, after);
+				ft::uninitialized_copy(mid, last, old_end, allocator);
+				_size += count - after;
+				try { ft::uninitialized_copy(gap, old_end, gap + count, allocator); }
+				catch (...) {
+					ft::destroy(old_end, old_end + (count - after), allocator);
+					_size -= count - after;
+					throw;
+				}
+				_size += after;
+				for (pointer p = gap; first != mid; ++p, ++first)
+					*p = *first;
+			}
+		}
+
+		void close_gap(pointer from, pointer to, ft::true_type) {
+			ft::destroy(from, to, allocator);
+			ft::relocate_bytes(to, buffer + _size, from);
+		}
+
+		void close_gap(pointer from, pointer to, ft::false_type) {
+			pointer end = buffer + _size;
+
+			for (; to != end; ++from, ++to)
+				*from = *to;
+			ft::destroy(from, end, allocator);
+		}
+	};
+
+	template <class T, std::size_t N, class A, class G>
+	inline bool operator== (const small_vector<T, N, A, G> &lhs, const small_vector<T, N, A, G> &rhs)
+	{ return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
+
+	template <class T, std::size_t N, class A, class G>
+	inline bool operator!= (const small_vector<T, N, A, G> &lhs, const small_vector<T, N, A, G> &rhs)
+	{ return !(lhs == rhs); }
+
+	template <class T, std::size_t N, class A, class G>
+	inline bool operator< (const small_vector<T, N, A, G> &lhs, const small_vector<T, N, A, G> &rhs)
+	{ return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end()); }
+
+	template <class T, std::size_t N, class A, class G>
+	inline bool operator> (const small_vector<T, N, A, G> &lhs, const small_vector<T, N, A, G> &rhs)
+	{ return rhs < lhs; }
+
+	template <class T, std::size_t N, class A, class G>
+	inline bool operator<= (const small_vector<T, N, A, G> &lhs, const small_vector<T, N, A, G> &rhs)
+	{ return !(rhs < lhs); }
+
+	template <class T, std::size_t N, class A, class G>
+	inline bool operator>= (const small_vector<T, N, A, G> &lhs, const small_vector<T, N, A, G> &rhs)
+	{ return !(lhs < rhs); }
+
+	template <class T, std::size_t N, class A, class G>
+	inline void swap(small_vector<T, N, A, G> &lhs, small_vector<T, N, A, G> &rhs)
+	{ lhs.swap(rhs); }
+}
+
+#endif
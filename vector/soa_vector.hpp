@@ -0,0 +1,376 @@
+/*
+ * ft::soa_vector<ft::pair<T1, T2>, Allocator, Growth>
+ * ---------------------------------------------------
+ * A vector of pairs stored as two columns: every first in one contiguous
+ * array, every second in another.
+ *
+ * Template Parameters:
+ *   - Record: The row type, ft::pair<T1, T2>.
+ *   - Allocator: Memory allocator, rebound for each column
+ *     (default: std::allocator<Record>).
+ *   - Growth: Growth policy of the columns (default: ft::growth_double).
+ *
+ * Features:
+ *   - A scan of one field only reads that field's array
+ *   - first_column() and second_column() return ft::span views that plain
+ *     loops, and the compiler's vectorizer, can run over
+ *   - Row-wise random access iterators whose reference is a proxy with
+ *     first and second members, so the ft:: algorithms work on rows
+ *   - Each column is an ft::vector, with its memcpy growth and fill paths
+ *
+ * Example Usage:
+ *   ft::soa_vector<ft::pair<int, double> > v;
+ *   v.push_back(ft::make_pair(1, 0.5));
+ *   ft::span<const double> prices = v.second_column();
+ *   double total = 0;
+ *   for (size_t i = 0; i < prices.size(); ++i)
+ *       total += prices[i];
+ *   v[0].second = 2.0;                     // writes through the proxy
+ *
+ * Methods:
+ *   - Constructors: default, fill, range, copy
+ *   - operator=
+ *   - at, operator[], front, back, first_column, second_column
+ *   - begin, end, rbegin, rend
+ *   - empty, size, capacity, max_size
+ *   - reserve, clear, insert, erase, push_back, pop_back, resize, swap
+ *   - Comparison operators
+ *
+ * Notes:
+ *   - Throws std::out_of_range on invalid access in at().
+ *   - Rows are proxies: write (*it).first, not it->first, and copy a row out
+ *     as an ft::pair (value_type row = v[i]) to keep it.
+ *   - push_back, insert and resize undo the first column if the second one
+ *     throws, so both always have the same size.
+ *   - bool fields are stored one per byte, not packed like
+ *     ft::vector<bool>, so rows and second_column() work for them too.
+ *   - Other record types get the same layout by specializing soa_vector
+ *     for them.
+ */
+#ifndef _SOA_VECTOR_HPP_
+#define _SOA_VECTOR_HPP_
+
+
+#include <stdexcept>
+
+#include "vector.hpp"
+#include "../utils/span.hpp"
+#include "../utils/index_iterator.hpp"
+#include "../utils/reverse_iterator.hpp"
+#include "../utils/utility.hpp"
+#include "../utils/algorithm.hpp"
+
+
+namespace ft {
+	template < class Record, class A = std::allocator<Record>, class G = ft::growth_double >
+	class soa_vector;
+
+	//What a column stores for a field of type T: T itself, except bool,
+	//whose ft::vector is packed into bits and can hand out neither a bool&
+	//nor a contiguous span. Bools are kept one per byte in a slot instead.
+	template <class T>
+	struct soa_column
+	{
+		typedef T	slot;
+
+		static T*		values(slot* p) { return p; }
+		static const T*	values(const slot* p) { return p; }
+	};
+
+	template <>
+	struct soa_column<bool>
+	{
+		struct slot
+		{
+			bool	value;
+
+			slot(bool v = false) : value(v) {}
+		};
+
+		//slot is a standard-layout struct of one bool, so an array of them
+		//is an array of bools
+		static bool*		values(slot* p) { return reinterpret_cast<bool*>(p); }
+		static const bool*	values(const slot* p) { return reinterpret_cast<const bool*>(p); }
+	};
+
+	template < class T1, class T2, class A, class G >
+	class soa_vector<ft::pair<T1, T2>, A, G>
+	{
+	public:
+
+		class reference;
+		class const_reference;
+
+		typedef ft::pair<T1, T2>											value_type;
+		typedef T1															first_type;
+		typedef T2															second_type;
+		typedef A															allocator_type;
+		typedef G															growth_policy;
+		typedef std::size_t 												size_type;
+		typedef std::ptrdiff_t												difference_type;
+		typedef reference*													pointer;
+		typedef const const_reference*										const_pointer;
+		typedef ft::index_iterator<soa_vector, value_type, reference, pointer>				iterator;
+		typedef ft::index_iterator<const soa_vector, value_type, const_reference, const_pointer>	const_iterator;
+		typedef ft::reverse_iterator<iterator> 								reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>						const_reverse_iterator;
+
+		//A read-only row. Rows compare like ft::pair, with each other and with
+		//ft::pair values.
+		class const_reference
+		{
+		public:
+			const T1&	first;
+			const T2&	second;
+
+			const_reference(const T1& f, const T2& s) : first(f), second(s) {}
+
+			const_reference(const value_type& p) : first(p.first), second(p.second) {}
+
+			operator value_type() const { return value_type(first, second); }
+
+			friend bool	operator==(const const_reference& x, const const_reference& y)
+			{ return x.first == y.first && x.second == y.second; }
+
+			friend bool	operator!=(const const_reference& x, const const_reference& y)
+			{ return !(x == y); }
+
+			friend bool	operator<(const const_reference& x, const const_reference& y)
+			{ return x.first < y.first || (!(y.first < x.first) && x.second < y.second); }
+
+			friend bool	operator>(const const_reference& x, const const_reference& y)
+			{ return y < x; }
+
+			friend bool	operator<=(const const_reference& x, const const_reference& y)
+			{ return !(y < x); }
+
+			friend bool	operator>=(const const_reference& x, const const_reference& y)
+			{ return !(x < y); }
+
+		private:
+			const_reference&	operator=(const const_reference&);
+		};
+
+		//A writable row: assigning to it, or to its members, writes the columns.
+		class reference : public const_reference
+		{
+		public:
+			T1&		first;
+			T2&		second;
+
+			reference(T1& f, T2& s) : const_reference(f, s), first(f), second(s) {}
+
+			reference&	operator=(const value_type& p)
+			{
+				first = p.first;
+				second = p.second;
+				return *this;
+			}
+
+			reference&	operator=(const reference& x)
+			{
+				first = x.first;
+				second = x.second;
+				return *this;
+			}
+
+			operator value_type() const { return value_type(first, second); }
+		};
+
+	private:
+
+		typedef ft::soa_column<T1>												first_traits;
+		typedef ft::soa_column<T2>												second_traits;
+		typedef typename first_traits::slot										first_slot;
+		typedef typename second_traits::slot									second_slot;
+		typedef ft::vector<first_slot, typename A::template rebind<first_slot>::other, G>		first_column_type;
+		typedef ft::vector<second_slot, typename A::template rebind<second_slot>::other, G>	second_column_type;
+
+		first_column_type									_first;
+		second_column_type									_second;
+
+	public:
+
+		explicit soa_vector(const A& alloc = A()) : _first(alloc), _second(alloc) {}
+
+		soa_vector(size_type count, const value_type& value = value_type(), const A& alloc = A())
+		: _first(count, value.first, alloc), _second(count, value.second, alloc) {}
+
+		template <class InputIterator>
+		soa_vector(InputIterator first, InputIterator last, const A& alloc = A(),
+			   typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0)
+		: _first(alloc), _second(alloc) {
+			for (; first != last; ++first)
+				push_back(*first);
+		};
+
+		allocator_type get_allocator() const { return allocator_type(_first.get_allocator()); };
+
+		//-------------| Element access |-------
+
+		reference at(size_type pos) {
+			if (pos >= size())
+				throw std::out_of_range("soa_vector");
+			return (*this)[pos];
+		};
+
+		const_reference at(size_type pos) const {
+			if (pos >= size())
+				throw std::out_of_range("soa_vector");
+			return (*this)[pos];
+		};
+
+		reference				operator[](size_type pos) 				{ return reference(first_values()[pos], second_values()[pos]); };
+		const_reference			operator[](size_type pos) const 		{ return const_reference(first_values()[pos], second_values()[pos]); };
+		reference				front() 								{ return (*this)[0]; };
+		const_reference			front() const 							{ return (*this)[0]; };
+		reference				back() 									{ return (*this)[size() - 1]; };
+		const_reference			back() const 							{ return (*this)[size() - 1]; };
+
+		//one field of every row, contiguous; valid until the vector grows
+		ft::span<T1>			first_column() 							{ return ft::span<T1>(first_values(), _first.size()); };
+		ft::span<const T1>		first_column() const 					{ return ft::span<const T1>(first_values(), _first.size()); };
+		ft::span<T2>			second_column() 						{ return ft::span<T2>(second_values(), _second.size()); };
+		ft::span<const T2>		second_column() const 					{ return ft::span<const T2>(second_values(), _second.size()); };
+
+		//-------------| Iterator FUNCTIONS |-------
+
+		iterator				begin() 								{ return iterator(this, 0); };
+		const_iterator			begin() const 							{ return const_iterator(this, 0); };
+		iterator				end() 									{ return iterator(this, size()); };
+		const_iterator			end() const 							{ return const_iterator(this, size()); };
+		reverse_iterator		rbegin() 								{ return reverse_iterator(end()); };
+		const_reverse_iterator	rbegin() const 							{ return const_reverse_iterator(end()); };
+		reverse_iterator		rend() 									{ return reverse_iterator(begin()); };
+		const_reverse_iterator	rend() const 							{ return const_reverse_iterator(begin()); };
+
+		//-------------| Capacity |-------
+
+		bool					empty() const 							{ return _first.empty(); };
+		size_type				size() const 							{ return _first.size(); };
+		size_type				capacity() const 						{ return _first.capacity() < _second.capacity() ? _first.capacity() : _second.capacity(); };
+
+		size_type max_size() const {
+			return _first.max_size() < _second.max_size() ? _first.max_size() : _second.max_size();
+		};
+
+		void reserve(size_type size) {
+			_first.reserve(size);
+			_second.reserve(size);
+		};
+
+		//-------------| Modifiers |-------
+
+		void clear() {
+			_first.clear();
+			_second.clear();
+		};
+
+		void push_back(const value_type& value) {
+			_first.push_back(value.first);
+			try { _second.push_back(value.second); }
+			catch (...) {
+				_first.pop_back();
+				throw;
+			}
+		};
+
+		void pop_back() {
+			_first.pop_back();
+			_second.pop_back();
+		};
+
+		void resize(size_type count, const value_type& value = value_type()) {
+			size_type old = size();
+
+			_first.resize(count, value.first);
+			try { _second.resize(count, value.second); }
+			catch (...) {
+				_first.resize(old);
+				throw;
+			}
+		};
+
+		iterator insert(const_iterator pos, const value_type& value) {
+			return insert(pos, 1, value);
+		};
+
+		iterator insert(const_iterator pos, size_type count, const value_type& value) {
+			size_type index = pos.index();
+
+			_first.insert(_first.begin() + index, count, value.first);
+			try { _second.insert(_second.begin() + index, count, value.second); }
+			catch (...) {
+				_first.erase(_first.begin() + index, _first.begin() + index + count);
+				throw;
+			}
+			return iterator(this, index);
+		};
+
+		iterator erase(const_iterator pos) {
+			return erase(pos, pos + 1);
+		};
+
+		iterator erase(const_iterator first, const_iterator last) {
+			size_type from = first.index();
+			size_type to = last.index();
+
+			_first.erase(_first.begin() + from, _first.begin() + to);
+			_second.erase(_second.begin() + from, _second.begin() + to);
+			return iterator(this, from);
+		};
+
+		void swap(soa_vector& other) {
+			_first.swap(other._first);
+			_second.swap(other._second);
+		};
+
+	private:
+
+		T1*				first_values() 							{ return first_traits::values(_first.data()); };
+		const T1*		first_values() const 					{ return first_traits::values(_first.data()); };
+		T2*				second_values() 						{ return second_traits::values(_second.data()); };
+		const T2*		second_values() const 					{ return second_traits::values(_second.data()); };
+	};
+
+	template <class T1, class T2, class A, class G>
+	bool operator==(const ft::soa_vector<ft::pair<T1, T2>, A, G>& lhs, const ft::soa_vector<ft::pair<T1, T2>, A, G>& rhs) {
+		ft::span<const T1>	lf = lhs.first_column();
+		ft::span<const T2>	ls = lhs.second_column();
+
+		return lhs.size() == rhs.size() && ft::equal(lf.begin(), lf.end(), rhs.first_column().begin())
+			&& ft::equal(ls.begin(), ls.end(), rhs.second_column().begin());
+	}
+
+	template <class T1, class T2, class A, class G>
+	bool operator!=(const ft::soa_vector<ft::pair<T1, T2>, A, G>& lhs, const ft::soa_vector<ft::pair<T1, T2>, A, G>& rhs) {
+		return !(lhs == rhs);
+	}
+
+	template <class T1, class T2, class A, class G>
+	bool operator<(const ft::soa_vector<ft::pair<T1, T2>, A, G>& lhs, const ft::soa_vector<ft::pair<T1, T2>, A, G>& rhs) {
+		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
+	}
+
+	template <class T1, class T2, class A, class G>
+	bool operator<=(const ft::soa_vector<ft::pair<T1, T2>, A, G>& lhs, const ft::soa_vector<ft::pair<T1, T2>, A, G>& rhs) {
+		return !(rhs < lhs);
+	}
+
+	template <class T1, class T2, class A, class G>
+	bool operator>(const ft::soa_vector<ft::pair<T1, T2>, A, G>& lhs, const ft::soa_vector<ft::pair<T1, T2>, A, G>& rhs) {
+		return rhs < lhs;
+	}
+
+	template <class T1, class T2, class A, class G>
+	bool operator>=(const ft::soa_vector<ft::pair<T1, T2>, A, G>& lhs, const ft::soa_vector<ft::pair<T1, T2>, A, G>& rhs) {
+		return !(lhs < rhs);
+	}
+
+	template <class T1, class T2, class A, class G>
+	void swap(ft::soa_vector<ft::pair<T1, T2>, A, G>& lhs, ft::soa_vector<ft::pair<T1, T2>, A, G>& rhs) {
+		lhs.swap(rhs);
+	}
+}
+
+#endif //_SOA_VECTOR_HPP_
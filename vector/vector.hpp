@@ -6,6 +6,8 @@
  * Template Parameters:
  *   - T: Type of elements.
  *   - Allocator: Memory allocator (default: std::allocator<T>).
+ *   - Growth: Growth policy (default: ft::growth_double), see
+ *     utils/growth_policy.hpp.
  *
  * Features:
  *   - Dynamic resizing
@@ -27,34 +29,74 @@
  *   - at, operator[], front, back, data
  *   - begin, end, rbegin, rend
  *   - empty, size, capacity, max_size
- *   - reserve, clear, insert, erase, push_back, pop_back, resize, swap
+ *   - reserve, shrink_to_fit, clear, insert, erase, erase_front, push_back,
+ *     pop_back, resize, resize_uninitialized, append, swap
  *   - Comparison operators
+ *   - Non-members: erase, erase_if
  *
  * Notes:
  *   - Throws std::out_of_range on invalid access in at().
- *   - Uses doubling strategy for capacity growth.
+ *   - Capacity grows as the growth policy says: growth_double (2x, the
+ *     default), growth_golden (1.5x), growth_size_class (1.5x rounded to
+ *     allocator size classes) or growth_page_aligned (2x rounded to pages).
+ *     Wrapping one in shrink_hysteresis<> also gives memory back once erase
+ *     and pop_back leave the vector mostly empty; clear() never shrinks.
+ *   - Growth relocates elements with one memcpy when
+ *     ft::is_trivially_relocatable<T> holds, and by copy-construction plus
+ *     destruction otherwise.
+ *   - Range constructor, assign and insert accept any input iterator; forward
+ *     ranges are counted first so the storage is allocated once.
+ *   - Copies allocate exactly size() elements; assignment reuses the
+ *     existing block when it is big enough. Trivially copyable T is copied
+ *     with one memcpy.
+ *   - Fills (fill constructor, assign, fill insert, resize) use memset for
+ *     values made of one repeated byte and SIMD stores for other trivially
+ *     copyable T, see utils/fill.hpp.
+ *   - Range and fill insert allocate at most once; shifting the tail inside
+ *     the capacity is one memmove for trivially relocatable T.
+ *   - erase shifts the tail with one memmove for trivially relocatable T,
+ *     and like std::vector never changes capacity() or moves the elements
+ *     before the erased range.
+ *   - erase_front(n) removes the first n elements without moving the
+ *     others: begin() steps past them, and the freed slots, still counted
+ *     by capacity(), are reclaimed when the vector next grows, which keeps
+ *     sliding-window use amortized O(1) per element. That growth may slide
+ *     the elements down inside the block, so after erase_front pointers
+ *     can move even while size() stays within capacity().
+ *   - insert gives the strong exception guarantee. A middle insert of a
+ *     type that is not trivially relocatable copies the new elements aside
+ *     and swaps them into place when ft::is_nothrow_swappable<T> holds (it
+ *     does for std::string), and builds a new block otherwise; specialize
+ *     ft::basic_exception_guarantee<T> to shift such types in place with
+ *     the basic guarantee instead.
+ *   - With ft::mmap_allocator, large trivially relocatable buffers are grown
+ *     by mremap instead of being copied.
  */
 #ifndef _VECTOR_HPP_
 #define _VECTOR_HPP_
 
 
 #include <stdexcept>
+#include <functional>
 
 #include "../utils/iterator.hpp"
 #include "../utils/reverse_iterator.hpp"
 #include "../utils/utility.hpp"
 #include "../utils/type_traits.hpp"
 #include "../utils/algorithm.hpp"
+#include "../utils/memory.hpp"
+#include "../utils/growth_policy.hpp"
 
 
 namespace ft {
-	template < class T, class A = std::allocator<T> >
+	template < class T, class A = std::allocator<T>, class G = ft::growth_double >
 	class vector
 	{
 	public:
 
 		typedef T											value_type;
 		typedef A											allocator_type;
+		typedef G											growth_policy;
 		typedef std::size_t 								size_type;
 		typedef std::ptrdiff_t								difference_type;
 		typedef value_type&									reference;
@@ -71,74 +113,83 @@ namespace ft {
 		pointer												buffer;
 		size_type 											_capacity;
 		size_type 											_size;
+		size_type 											_front; // slots freed by erase_front before buffer
 		allocator_type										allocator;
 
 	public:
 
-		explicit vector(const A& alloc = A()) : buffer(0), _capacity(0), _size(0), allocator(alloc) {}
-
-		vector(size_type count, const_reference value = value_type(), const A& alloc = A()) {
-			if (count < 0)
-				throw std::out_of_range("vector");
-			allocator = alloc;
-			_capacity = _size = count;
-			buffer = allocator.allocate(_capacity);
-			for (size_t i = 0; i < count; ++i)
-				buffer[i] = value;
+		explicit vector(const A& alloc = A()) : buffer(0), _capacity(0), _size(0), _front(0), allocator(alloc) {}
+
+		vector(size_type count, const_reference value = value_type(), const A& alloc = A())
+		: buffer(0), _capacity(0), _size(0), _front(0), allocator(alloc) {
+			if (count == 0)
+				return;
+			buffer = allocator.allocate(count);
+			_capacity = count;
+			try { ft::uninitialized_fill_n(buffer, count, value, allocator); }
+			catch (...) { allocator.deallocate(buffer, count); throw; }
+			_size = count;
 		};
 
 		template <class InputIterator>
 		vector(InputIterator first, InputIterator last, const A& alloc = A(),
-			   typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0) : _capacity(0), _size(0), allocator(alloc) {
-			buffer = allocator.allocate(_capacity);
+			   typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0) : buffer(0), _capacity(0), _size(0), _front(0), allocator(alloc) {
 			this->assign(first, last);
 		};
 
-		vector(const vector& other) : buffer(0), _capacity(other._capacity), _size(other._size), allocator(other.get_allocator()) {
-			buffer = allocator.allocate(other._capacity);
-			for (size_t i = 0; i < _size; i++)
-				buffer[i] = other.buffer[i];
+		//allocates exactly other.size() elements, not other's capacity
+		vector(const vector& other) : buffer(0), _capacity(0), _size(0), _front(0), allocator(other.get_allocator()) {
+			if (other._size == 0)
+				return;
+			buffer = allocator.allocate(other._size);
+			_capacity = other._size;
+			try { ft::uninitialized_copy(other.buffer, other.buffer + other._size, buffer, allocator); }
+			catch (...) { allocator.deallocate(buffer, _capacity); throw; }
+			_size = other._size;
 		};
 
 		~vector() {
 			this->clear();
-			allocator.deallocate(buffer, _capacity);
+			release_storage();
 		};
 
+		//Reuses the current block when other fits in it, counting the slots
+		//erase_front freed, and otherwise moves to a block of exactly
+		//other.size() elements.
 		vector& operator=(const vector& other) {
 			if (this == &other)
 				return *this;
-			this->clear();
-			allocator.deallocate(buffer, _capacity);
-			_capacity = other._capacity;
-			_size = other._size;
-			buffer = allocator.allocate(_capacity);
-			for (size_t i = 0; i < _size; ++i) {
-				buffer[i] = other.buffer[i];
+			if (other._size > _capacity + _front) {
+				pointer tmp = allocator.allocate(other._size);
+				try { ft::uninitialized_copy(other.buffer, other.buffer + other._size, tmp, allocator); }
+				catch (...) { allocator.deallocate(tmp, other._size); throw; }
+				this->clear();
+				release_storage();
+				buffer = tmp;
+				_capacity = other._size;
+			} else {
+				this->clear();
+				ft::uninitialized_copy(other.buffer, other.buffer + other._size, buffer, allocator);
 			}
+			_size = other._size;
 			return *this;
 		};
 
 		void assign(size_type count, const_reference value ) {
-			if (count < 0)
-				throw std::out_of_range("vector");
+			value_type copy(value); // value may be one of the elements cleared below
 			this->clear();
-			this->reserve(count);
-			for (size_t i = 0; i < count; ++i, _size++)
-				buffer[i] = value;
+			if (count > _capacity)
+				this->reserve(recommend(count));
+			ft::uninitialized_fill_n(buffer, count, copy, allocator);
+			_size = count;
 		};
 
 
 		template <class InputIterator>
 		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type
 		assign(InputIterator first, InputIterator last) {
-			int range_size = last - first;
-			if (range_size < 0) throw std::length_error("vector");
 			this->clear();
-			this->reserve(range_size);
-			for (; first != last; ++first) {
-				this->push_back(*first);
-			}
+			assign_range(first, last, typename ft::iterator_category_of<InputIterator>::type());
 		};
 
 		allocator_type get_allocator() const { return this->allocator; };
@@ -174,55 +225,49 @@ namespace ft {
 		const_reverse_iterator 	rend() const								{ return const_reverse_iterator(const_iterator(buffer - 1)); };
 		bool 					empty() const								{ return _size <= 0; };
 		size_type				size() const								{ return _size; };
-		size_type				capacity() const							{ return _capacity; };
+		size_type				capacity() const							{ return _capacity + _front; };
 		size_type				max_size() const 							{ return value_type(-1); };
 
 
 		void reserve(size_type size) {
-			if (size > _capacity) {
-				T* tmp = allocator.allocate(size);
-				for (size_t i = 0; i < _size; ++i)
-					tmp[i] = buffer[i];
-				if (buffer) allocator.deallocate(buffer, _capacity);
-				_capacity = size;
-				buffer = tmp;
-			}
+			if (size > _capacity + _front)
+				reallocate(size, can_reallocate());
 		};
 
+		//moves the elements to a block of exactly size() slots, or frees the
+		//block if there are none
+		void shrink_to_fit() {
+			shrink_to(_size);
+		}
+
 		void clear() {
 			for (size_type i = 0; i < _size; i++) {
 				allocator.destroy(buffer + i);
 			}
 			_size = 0;
+			buffer -= _front;
+			_capacity += _front;
+			_front = 0;
 		};
 
 		void insert( iterator pos, size_type count, const T& value ) {
-			unsigned long index = pos - begin();
-			size_t max_size = _size + count;
-
-			if (count >= _capacity) {
-				reserve(_capacity + count);
-				_size = max_size;
-			} else {
-				while (_size != max_size) {
-					if (_size == _capacity)
-						reserve(_capacity * 2);
-					_size++;
-				}
-			}
-			for (unsigned long i = _size; i >= 0; --i) {
-				if (i == index + count - 1) {
-					for (; count > 0; --count, --i) {
-						buffer[i] = value;
-					}
-					return;
-				}
-				buffer[i] = buffer[i - count];
+			size_type index = pos - begin();
+
+			if (count == 0)
+				return;
+			if (!fits_in_place(index, count)) {
+				size_type new_cap = _size + count > capacity() ? recommend(_size + count) : capacity();
+				pointer tmp = allocator.allocate(new_cap);
+				try { ft::uninitialized_fill_n(tmp + index, count, value, allocator); }
+				catch (...) { allocator.deallocate(tmp, new_cap); throw; }
+				adopt(tmp, new_cap, index, count);
 			}
+			else
+				fill_gap(index, count, value_type(value), relocatable()); // value may live in the shifted tail
 		};
 
 		iterator insert(iterator pos, const_reference value) {
-			int index = pos - begin();
+			size_type index = pos - begin();
 			this->insert(pos, 1, value);
 			return iterator(buffer + index);
 		};
@@ -230,151 +275,508 @@ namespace ft {
 		template <class InputIt>
 		typename ft::enable_if<!ft::is_integral<InputIt>::value, void>::type
 		insert( iterator pos, InputIt first, InputIt last) {
-			size_t range_size = last - first;
-			if (!validate_iterator_values(first, last, range_size))
-				throw std::exception();
-			size_t new_size = _size + range_size;
-
-			int last_index = (pos - begin()) + range_size - 1;
-			if (range_size >= _capacity) {
-				reserve(_capacity + range_size);
-				_size = new_size;
-			} else {
-				while (_size != new_size) {
-					if (_size == _capacity)
-						reserve(_capacity * 2);
-					_size++;
-				}
-			}
-			for (int i = _size - 1; i >= 0; --i) {
-				if (i == last_index) {
-					for (; range_size > 0; --range_size, --i) {
-						buffer[i] = *--last;
-					}
-					return;
-				}
-				buffer[i] = buffer[i - range_size];
-			}
+			insert_range(pos, first, last, typename ft::iterator_category_of<InputIt>::type());
 		};
 
 		iterator erase( iterator pos )
 		{
-			int index = pos - begin();
-			for (size_t i = index; i < _size; ++i)
-			{
-				buffer[i] = buffer[i + 1];
-			}
-			if (_size > 0)
-			 _size--;
-			return pos;
+			return erase(pos, pos + 1);
 		}
 
 		iterator erase( iterator first, iterator last )
 		{
-			int start = first - begin();
-			int end = last - begin();
-			int offset = end - start;
+			pointer from = first.base();
+			pointer to = last.base();
+
+			if (from == to)
+				return first;
+			size_type index = from - buffer;
+			close_gap(from, to, relocatable());
+			_size -= to - from;
+			maybe_shrink();
+			return begin() + index;
+		}
 
-			_size -= offset;
-			for (size_t i = start; i < _size; ++i) {
-				buffer[i] = buffer[i + offset];
+		//Removes the first count elements without moving the others: begin()
+		//just steps past them, and the freed slots are reused by a later growth.
+		void erase_front(size_type count) {
+			ft::destroy(buffer, buffer + count, allocator);
+			buffer += count;
+			_front += count;
+			_capacity -= count;
+			_size -= count;
+			if (_size == 0) {
+				buffer -= _front;
+				_capacity += _front;
+				_front = 0;
 			}
-			return buffer + start;
+			maybe_shrink();
 		}
 
 		void push_back( const_reference value ) {
-			if (_size == _capacity)
-				(!_capacity) ? this->reserve(1) : this->reserve(_capacity * 2);
-			buffer[_size] = value;
+			if (_size == _capacity) {
+				value_type copy(value); // value may live in the buffer grow() frees
+				grow(_size + 1);
+				allocator.construct(buffer + _size, copy);
+			}
+			else
+				allocator.construct(buffer + _size, value);
 			++_size;
 		};
 
 		void pop_back() {
-			allocator.destroy(buffer + _size);
 			_size--;
+			allocator.destroy(buffer + _size);
+			maybe_shrink();
 		}
 
 		void resize( size_type count, T value = T() ) {
+			if (count < _size)
+				erase(begin() + count, end());
+			else
+				insert(end(), count - _size, value);
+		}
+
+		//Like resize, but new elements are default-initialized: for trivial T
+		//they keep whatever bytes the storage held, ready to be overwritten
+		//by read() or recv() without a zero-filling pass first.
+		void resize_uninitialized( size_type count ) {
 			if (count < _size) {
-				while (_size != count)
-					pop_back();
-			} else {
-				if (_capacity * 2 < count)
-					reserve(count);
-				while (_size != count)
-					push_back(value);
+				erase(begin() + count, end());
+				return;
 			}
+			if (count > _capacity)
+				grow(count);
+			ft::uninitialized_default_construct(buffer + _size, buffer + count, allocator);
+			_size = count;
+		}
+
+		//appends the count elements at ptr, reserving once and copying them
+		//with one memcpy for trivially copyable T; ptr may point into *this
+		void append( const_pointer ptr, size_type count ) {
+			insert_range(end(), ptr, ptr + count, ft::random_access_iterator_tag());
 		}
 
 		void swap( vector& other ) {
 			std::swap(_size, other._size);
 			std::swap(_capacity, other._capacity);
+			std::swap(_front, other._front);
 			std::swap(buffer, other.buffer);
 			std::swap(allocator, other.allocator);
 		}
 
 	private:
 
-		template<class InputIt>
-		typename ft::enable_if<!ft::is_integral<InputIt>::value, bool>::type
-		validate_iterator_values(InputIt first, InputIt last, size_t range) {
-			pointer reserved_buffer;
-			reserved_buffer = allocator.allocate(range);
-			bool result = true;
-			size_t i = 0;
-
-			for (;first != last; ++first, ++i) {
-				try { reserved_buffer[i] = *first; }
-				catch (...) { result = false; break; }
+		//capacity the growth policy picks to hold required elements
+		size_type recommend(size_type required) const {
+			return G::grow(_capacity + _front, required, sizeof(T));
+		}
+
+		typedef typename ft::is_trivially_relocatable<T>::type		relocatable;
+		typedef typename ft::integral_constant<bool, relocatable::value
+							&& ft::allocator_can_reallocate<A>::value>::type	can_reallocate;
+
+		//Makes room for required elements. When they fit in capacity() the
+		//elements slide back over the slots erase_front freed, by one memmove
+		//if T is trivially relocatable; other types need the two ranges apart
+		//and otherwise move to a fresh block of the same capacity.
+		void grow(size_type required) {
+			if (_front && required <= _capacity + _front) {
+				if (relocatable::value || _front >= _size)
+					slide_to_front(relocatable());
+				else
+					reallocate(_capacity + _front, ft::false_type());
+			}
+			else
+				reallocate(recommend(required), can_reallocate());
+		}
+
+		void slide_to_front(ft::true_type) {
+			pointer base = buffer - _front;
+			ft::relocate_bytes(buffer, buffer + _size, base);
+			buffer = base;
+			_capacity += _front;
+			_front = 0;
+		}
+
+		//the regions cannot overlap since _front >= _size
+		void slide_to_front(ft::false_type) {
+			pointer base = buffer - _front;
+			ft::uninitialized_relocate(buffer, buffer + _size, base, allocator);
+			buffer = base;
+			_capacity += _front;
+			_front = 0;
+		}
+
+		//Moves to a block of size slots (at least size()), freeing it all when
+		//size is 0. With a reallocating allocator the block shrinks in place.
+		void shrink_to(size_type size) {
+			if (size < _size)
+				size = _size;
+			if (size >= _capacity + _front)
+				return;
+			if (size == 0) {
+				release_storage();
+				buffer = 0;
+				_capacity = _front = 0;
+				return;
+			}
+			reallocate(size, can_reallocate());
+		}
+
+		//Gives back what the growth policy says the elements no longer need.
+		//Shrinking is only an optimization, so a failed one is dropped and the
+		//vector keeps its block.
+		void maybe_shrink() {
+			size_type target = G::shrink(_capacity + _front, _size, sizeof(T));
+
+			if (target < _capacity + _front) {
+				try { shrink_to(target); }
+				catch (...) {}
 			}
-			allocator.deallocate(reserved_buffer, range);
-			return result;
 		}
+
+		void release_storage() {
+			if (buffer)
+				allocator.deallocate(buffer - _front, _capacity + _front);
+		}
+
+		//Whether count elements can be inserted at index without a new block.
+		//Shifting in place keeps the strong guarantee when appending, when
+		//the tail moves bytewise or when it moves by non-throwing swaps;
+		//otherwise it needs the basic guarantee opt-in.
+		bool fits_in_place(size_type index, size_type count) const {
+			return _size + count <= _capacity
+				&& (index == _size || relocatable::value || ft::is_nothrow_swappable<T>::value
+					|| ft::basic_exception_guarantee<T>::value);
+		}
+
+		//whether a middle insert inside the capacity goes through swap_in
+		bool swaps_in_place(size_type index) const {
+			return index != _size && ft::is_nothrow_swappable<T>::value;
+		}
+
+		//moves the elements to a block of size slots
+		void reallocate(size_type size, ft::false_type) {
+			adopt(allocator.allocate(size), size, _size, 0);
+		}
+
+		//Moves the elements into tmp, a block of new_cap slots whose count
+		//slots at index already hold new elements, then frees the old block.
+		//If moving throws, tmp is torn down and the vector is left as it was.
+		void adopt(pointer tmp, size_type new_cap, size_type index, size_type count) {
+			try { move_storage(tmp, index, count, relocatable()); }
+			catch (...) {
+				ft::destroy(tmp + index, tmp + index + count, allocator);
+				allocator.deallocate(tmp, new_cap);
+				throw;
+			}
+			release_storage();
+			buffer = tmp;
+			_capacity = new_cap;
+			_front = 0;
+			_size += count;
+		}
+
+		//prefix to tmp, suffix to tmp + index + count
+		void move_storage(pointer tmp, size_type index, size_type count, ft::true_type) {
+			ft::uninitialized_relocate(buffer, buffer + index, tmp, allocator);
+			ft::uninitialized_relocate(buffer + index, buffer + _size, tmp + index + count, allocator);
+		}
+
+		//copies both halves before destroying anything, so a throw loses nothing
+		void move_storage(pointer tmp, size_type index, size_type count, ft::false_type) {
+			pointer mid = ft::uninitialized_copy(buffer, buffer + index, tmp, allocator);
+			try { ft::uninitialized_copy(buffer + index, buffer + _size, mid + count, allocator); }
+			catch (...) { ft::destroy(tmp, mid, allocator); throw; }
+			ft::destroy(buffer, buffer + _size, allocator);
+		}
+
+		//single pass: the elements cannot be counted before they are read
+		template <class InputIt>
+		void assign_range(InputIt first, InputIt last, ft::input_iterator_tag) {
+			for (; first != last; ++first)
+				this->push_back(*first);
+		}
+
+		//counted up front, so the storage is allocated once
+		template <class ForwardIt>
+		void assign_range(ForwardIt first, ForwardIt last, ft::forward_iterator_tag) {
+			size_type count = ft::distance(first, last);
+
+			if (count > _capacity)
+				this->reserve(recommend(count));
+			ft::uninitialized_copy(first, last, buffer, allocator);
+			_size = count;
+		}
+
+		//Appends in place; anywhere else the input is buffered first, so the
+		//tail is shifted once instead of once per element.
+		template <class InputIt>
+		void insert_range(iterator pos, InputIt first, InputIt last, ft::input_iterator_tag) {
+			if (pos == end()) {
+				for (; first != last; ++first)
+					this->push_back(*first);
+				return;
+			}
+			vector tmp(first, last, allocator);
+			insert_range(pos, tmp.begin(), tmp.end(), ft::forward_iterator_tag());
+		}
+
+		template <class ForwardIt>
+		void insert_range(iterator pos, ForwardIt first, ForwardIt last, ft::forward_iterator_tag) {
+			size_type index = pos - begin();
+			size_type count = ft::distance(first, last);
+
+			if (count == 0)
+				return;
+			if (!fits_in_place(index, count)) {
+				size_type new_cap = _size + count > capacity() ? recommend(_size + count) : capacity();
+				pointer tmp = allocator.allocate(new_cap);
+				try { ft::uninitialized_copy(first, last, tmp + index, allocator); }
+				catch (...) { allocator.deallocate(tmp, new_cap); throw; }
+				adopt(tmp, new_cap, index, count);
+			}
+			else
+				copy_gap(index, first, last, count, relocatable());
+		}
+
+		//Removes [from, to), which is not at the front. Trivially relocatable
+		//tails move down with one memmove over the destroyed range.
+		void close_gap(pointer from, pointer to, ft::true_type) {
+			ft::destroy(from, to, allocator);
+			ft::relocate_bytes(to, buffer + _size, from);
+		}
+
+		//other tails are assigned down and the leftover tail slots destroyed
+		void close_gap(pointer from, pointer to, ft::false_type) {
+			pointer end = buffer + _size;
+
+			for (; to != end; ++from, ++to)
+				*from = *to;
+			ft::destroy(from, end, allocator);
+		}
+
+		//Opens count slots at index inside the capacity and fills them with
+		//value. Trivially relocatable tails move with one memmove, and move
+		//back if a copy throws.
+		void fill_gap(size_type index, size_type count, const_reference value, ft::true_type) {
+			pointer gap = buffer + index;
+			ft::relocate_bytes(gap, buffer + _size, gap + count);
+			try { ft::uninitialized_fill_n(gap, count, value, allocator); }
+			catch (...) { ft::relocate_bytes(gap + count, buffer + _size + count, gap); throw; }
+			_size += count;
+		}
+
+		//Other tails are copy-constructed past the end where they land on raw
+		//slots and assigned backwards where they land on live ones.
+		void fill_gap(size_type index, size_type count, const_reference value, ft::false_type) {
+			if (swaps_in_place(index)) {
+				vector fresh(count, value, allocator);
+				swap_in(index, fresh);
+				return;
+			}
+			pointer gap = buffer + index;
+			pointer old_end = buffer + _size;
+			size_type after = _size - index;
+
+			if (after > count) {
+				ft::uninitialized_copy(old_end - count, old_end, old_end, allocator);
+				_size += count;
+				for (pointer src = old_end - count, dst = old_end; src != gap; )
+					*--dst = *--src;
+				for (pointer p = gap; p != gap + count; ++p)
+					*p = value;
+			} else {
+				ft::uninitialized_fill_n(old_end, count - after, value, allocator);
+				_size += count - after;
+				try { ft::uninitialized_copy(gap, old_end, gap + count, allocator); }
+				catch (...) {
+					ft::destroy(old_end, old_end + (count - after), allocator);
+					_size -= count - after;
+					throw;
+				}
+				_size += after;
+				for (pointer p = gap; p != old_end; ++p)
+					*p = value;
+			}
+		}
+
+		//same as fill_gap, with the new elements taken from [first, last)
+		template <class InputIt>
+		void copy_gap(size_type index, InputIt first, InputIt last, size_type count, ft::true_type) {
+			pointer gap = buffer + index;
+			ft::relocate_bytes(gap, buffer + _size, gap + count);
+			try { ft::uninitialized_copy(first, last, gap, allocator); }
+			catch (...) { ft::relocate_bytes(gap + count, buffer + _size + count, gap); throw; }
+			_size += count;
+		}
+
+		template <class InputIt>
+		void copy_gap(size_type index, InputIt first, InputIt last, size_type count, ft::false_type) {
+			if (swaps_in_place(index)) {
+				vector fresh(first, last, allocator);
+				swap_in(index, fresh);
+				return;
+			}
+			pointer gap = buffer + index;
+			pointer old_end = buffer + _size;
+			size_type after = _size - index;
+
+			if (after > count) {
+				ft::uninitialized_copy(old_end - count, old_end, old_end, allocator);
+				_size += count;
+				for (pointer src = old_end - count, dst = old_end; src != gap; )
+					*--dst = *--src;
+				for (pointer p = gap; first != last; ++p, ++first)
+					*p = *first;
+			} else {
+				InputIt mid = first;
+				ft::advance(mid, after);
+				ft::uninitialized_copy(mid, last, old_end, allocator);
+				_size += count - after;
+				try { ft::uninitialized_copy(gap, old_end, gap + count, allocator); }
+				catch (...) {
+					ft::destroy(old_end, old_end + (count - after), allocator);
+					_size -= count - after;
+					throw;
+				}
+				_size += after;
+				for (pointer p = gap; first != mid; ++p, ++first)
+					*p = *first;
+			}
+		}
+
+		//Opens fresh.size() slots at index and swaps fresh's elements into
+		//them. Only copies into raw slots past the end can throw, and those
+		//are undone; the shift of the live tail and the swaps come after, so
+		//a throw leaves the vector as it was. fresh keeps the displaced values.
+		void swap_in(size_type index, vector& fresh) {
+			using std::swap;
+			size_type count = fresh._size;
+			pointer src = fresh.buffer;
+			pointer gap = buffer + index;
+			pointer old_end = buffer + _size;
+			size_type after = _size - index;
+
+			if (after > count) {
+				ft::uninitialized_copy(old_end - count, old_end, old_end, allocator);
+				for (pointer dst = old_end; dst != gap + count; ) {
+					--dst;
+					swap(*dst, *(dst - count));
+				}
+			} else {
+				ft::uninitialized_copy(src + after, src + count, old_end, allocator);
+				try { ft::uninitialized_copy(gap, old_end, gap + count, allocator); }
+				catch (...) { ft::destroy(old_end, old_end + (count - after), allocator); throw; }
+				count = after;
+			}
+			for (size_type i = 0; i < count; ++i)
+				swap(gap[i], src[i]);
+			_size += fresh._size;
+		}
+
+		//Lets the allocator resize the block itself, e.g. with mremap. The
+		//elements first slide down over the slots erase_front freed, and
+		//slide back if the allocator throws, which leaves its block as it was.
+		void reallocate(size_type size, ft::true_type) {
+			if (!buffer) {
+				reallocate(size, ft::false_type());
+				return;
+			}
+			pointer base = buffer - _front;
+			ft::relocate_bytes(buffer, buffer + _size, base);
+			try { buffer = allocator.reallocate(base, _capacity + _front, size, _size); }
+			catch (...) { ft::relocate_bytes(base, base + _size, buffer); throw; }
+			_capacity = size;
+			_front = 0;
+		}
+
 	};
 
-	template <class T, class A>
-	inline bool operator== (const vector<T, A> &lhs, const vector<T, A> &rhs)
+	template <class T, class A, class G>
+	inline bool operator== (const vector<T, A, G> &lhs, const vector<T, A, G> &rhs)
 	{ return lhs.size() == rhs.size() && ft::equal(lhs.begin(), lhs.end(), rhs.begin()); }
 
-	template <class T, class A>
-	inline bool operator!= (const vector<T, A> &lhs, const vector<T, A> &rhs)
+	template <class T, class A, class G>
+	inline bool operator!= (const vector<T, A, G> &lhs, const vector<T, A, G> &rhs)
 	{ return !(lhs == rhs); }
 
-	template <class T, class A>
-	inline bool operator< (const vector<T, A> &lhs, const vector<T, A> &rhs)
+	template <class T, class A, class G>
+	inline bool operator< (const vector<T, A, G> &lhs, const vector<T, A, G> &rhs)
 	{
 		return ft::lexicographical_compare(lhs.begin(), lhs.end(), rhs.begin(), rhs.end());
 	}
 
-	template <class T, class A>
-	inline bool operator> (const vector<T, A> &lhs, const vector<T, A> &rhs) {
+	template <class T, class A, class G>
+	inline bool operator> (const vector<T, A, G> &lhs, const vector<T, A, G> &rhs) {
 		return rhs < lhs;
 	}
 
-	template <class T, class A>
-	inline bool operator<= (const vector<T, A> &lhs, const vector<T, A> &rhs) {
+	template <class T, class A, class G>
+	inline bool operator<= (const vector<T, A, G> &lhs, const vector<T, A, G> &rhs) {
 		return !(rhs < lhs);
 	}
 
-	template <class T, class A>
-	inline bool operator>= (const vector<T, A> &lhs, const vector<T, A> &rhs) {
+	template <class T, class A, class G>
+	inline bool operator>= (const vector<T, A, G> &lhs, const vector<T, A, G> &rhs) {
 		return !(lhs < rhs);
 	}
 
-	template <class T, class A>
-	void swap(const ft::vector<T, A> &v1, const ft::vector<T, A> &v2 )
+	template <class T, class A, class G>
+	void swap(ft::vector<T, A, G> &v1, ft::vector<T, A, G> &v2 )
 	{
 		v1.swap(v2);
 	}
-}
 
+	//Copies every element forward and advances the output only past the
+	//survivors, so the loop has no data-dependent branch to mispredict.
+	template <class T, class Pred>
+	T*	compact(T* first, T* last, Pred pred, ft::true_type)
+	{
+		T* out = first;
 
-namespace std
-{
-	template <class T, class A>
-	void swap(ft::vector<T, A> &v1, ft::vector<T, A> &v2 )
+		for (; first != last; ++first) {
+			*out = *first;
+			out += !pred(*first);
+		}
+		return out;
+	}
+
+	template <class T, class Pred>
+	T*	compact(T* first, T* last, Pred pred, ft::false_type)
 	{
-		v1.swap(v2);
+		T* out = first;
+
+		for (; first != last; ++first) {
+			if (!pred(*first)) {
+				if (out != first)
+					*out = *first;
+				++out;
+			}
+		}
+		return out;
+	}
+
+	//Removes every element pred holds for in one forward pass and returns
+	//how many were removed. Survivors keep their order.
+	template <class T, class A, class G, class Pred>
+	typename vector<T, A, G>::size_type	erase_if(vector<T, A, G>& v, Pred pred)
+	{
+		T* end = v.data() + v.size();
+		T* out = ft::compact(v.data(), end, pred, typename ft::is_trivially_copyable<T>::type());
+
+		v.erase(typename vector<T, A, G>::iterator(out), v.end());
+		return end - out;
+	}
+
+	template <class T, class A, class G>
+	typename vector<T, A, G>::size_type	erase(vector<T, A, G>& v, const T& value)
+	{
+		return ft::erase_if(v, std::bind2nd(std::equal_to<T>(), value)); // the binder copies value
 	}
 }
+
+#include "vector_bool.hpp"
+
 #endif
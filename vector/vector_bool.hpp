@@ -0,0 +1,452 @@
+/*
+ * ft::vector<bool, Allocator, Growth>
+ * -----------------------------------
+ * Specialization of ft::vector that packs 64 flags into each machine word.
+ *
+ * Features:
+ *   - One bit per element instead of one byte
+ *   - operator[] and the iterators return a proxy reference that reads and
+ *     writes a single bit
+ *   - count() adds up whole words with popcnt
+ *   - find_first and find_next skip over zero words
+ *   - &=, |=, ^= and flip() combine whole bitmaps 128 bits at a time
+ *
+ * Example Usage:
+ *   ft::vector<bool> seen(1000000);
+ *   seen[42] = true;
+ *   seen |= other;
+ *   for (size_t i = seen.find_first(); i != seen.size(); i = seen.find_next(i))
+ *       std::cout << i << std::endl;
+ *
+ * Methods:
+ *   - Constructors: default, fill, range, copy
+ *   - operator=, assign
+ *   - at, operator[], front, back
+ *   - begin, end, rbegin, rend
+ *   - empty, size, capacity, max_size
+ *   - reserve, shrink_to_fit, clear, insert, erase, push_back, pop_back,
+ *     resize, swap, flip
+ *   - count, find_first, find_next, operator&=, operator|=, operator^=
+ *   - words, word_count
+ *   - Comparison operators
+ *
+ * Notes:
+ *   - Include vector/vector.hpp; it pulls this header in.
+ *   - The Allocator is rebound to ft::bit_word.
+ *   - Bits past size() in the last word are always 0, so count, find and
+ *     comparison work on whole words.
+ *   - The bitwise operators treat bits past the end of the shorter operand
+ *     as 0, so a &= b clears the bits past b.size().
+ *   - insert and erase in the middle move the following bits one at a time.
+ */
+#ifndef _VECTOR_BOOL_HPP_
+#define _VECTOR_BOOL_HPP_
+
+#include <cstring>
+
+#include "vector.hpp"
+#include "../utils/bit_ops.hpp"
+#include "../utils/index_iterator.hpp"
+
+namespace ft {
+	template <class A, class G>
+	class vector<bool, A, G>
+	{
+	public:
+
+		class reference;
+
+		typedef bool											value_type;
+		typedef A												allocator_type;
+		typedef G												growth_policy;
+		typedef std::size_t 									size_type;
+		typedef std::ptrdiff_t									difference_type;
+		typedef ft::bit_word									word_type;
+		typedef bool											const_reference;
+		typedef reference*										pointer;
+		typedef const bool*										const_pointer;
+		typedef ft::index_iterator<vector, bool, reference, pointer>		iterator;
+		typedef ft::index_iterator<const vector, bool, bool, const_pointer>	const_iterator;
+		typedef ft::reverse_iterator<iterator> 					reverse_iterator;
+		typedef ft::reverse_iterator<const_iterator>			const_reverse_iterator;
+
+		//proxy for one bit
+		class reference
+		{
+			friend class vector;
+
+			word_type*	word;
+			word_type	mask;
+
+			reference(word_type* w, word_type m) : word(w), mask(m) {}
+
+		public:
+			operator bool() const { return (*word & mask) != 0; }
+
+			reference&	operator=(bool x)
+			{
+				if (x)
+					*word |= mask;
+				else
+					*word &= ~mask;
+				return *this;
+			}
+
+			reference&	operator=(const reference& x) { return *this = bool(x); }
+
+			bool	operator~() const { return !bool(*this); }
+
+			void	flip() { *word ^= mask; }
+		};
+
+	private:
+
+		typedef typename A::template rebind<word_type>::other	word_allocator;
+
+		word_type*												_words;
+		size_type 												_capacity; // words
+		size_type 												_size; // bits
+		word_allocator											allocator;
+
+	public:
+
+		explicit vector(const A& alloc = A()) : _words(0), _capacity(0), _size(0), allocator(alloc) {}
+
+		vector(size_type count, bool value = false, const A& alloc = A())
+		: _words(0), _capacity(0), _size(0), allocator(alloc) {
+			resize(count, value);
+		};
+
+		template <class InputIterator>
+		vector(InputIterator first, InputIterator last, const A& alloc = A(),
+			   typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type* = 0)
+		: _words(0), _capacity(0), _size(0), allocator(alloc) {
+			try { assign(first, last); }
+			catch (...) { release_storage(); throw; }
+		};
+
+		//allocates exactly the words other.size() needs
+		vector(const vector& other) : _words(0), _capacity(0), _size(0), allocator(other.allocator) {
+			reserve(other._size);
+			copy_words(other);
+		};
+
+		~vector() {
+			release_storage();
+		};
+
+		vector& operator=(const vector& other) {
+			if (this != &other)
+			{
+				_size = 0;
+				reserve(other._size);
+				copy_words(other);
+			}
+			return *this;
+		};
+
+		void assign(size_type count, bool value) {
+			_size = 0;
+			resize(count, value);
+		};
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, void>::type
+		assign(InputIterator first, InputIterator last) {
+			_size = 0;
+			for (; first != last; ++first)
+				push_back(*first);
+		};
+
+		allocator_type get_allocator() const { return allocator_type(this->allocator); };
+
+		//-------------| Element access |-------
+
+		reference at(size_type pos) {
+			if (pos >= _size)
+				throw std::out_of_range("vector");
+			return (*this)[pos];
+		};
+
+		const_reference at(size_type pos) const {
+			if (pos >= _size)
+				throw std::out_of_range("vector");
+			return (*this)[pos];
+		};
+
+		reference				operator[](size_type pos) 				{ return reference(_words + pos / bits_per_word, word_type(1) << (pos % bits_per_word)); };
+		const_reference			operator[](size_type pos) const 		{ return (_words[pos / bits_per_word] >> (pos % bits_per_word)) & 1; };
+		reference				front() 								{ return (*this)[0]; };
+		const_reference			front() const 							{ return (*this)[0]; };
+		reference				back() 									{ return (*this)[_size - 1]; };
+		const_reference			back() const 							{ return (*this)[_size - 1]; };
+
+		//the packed words, bit i of the vector being bit i % 64 of word i / 64
+		const word_type*		words() const 							{ return _words; };
+		size_type				word_count() const 						{ return words_for(_size); };
+
+		//-------------| Iterator FUNCTIONS |-------
+
+		iterator				begin() 								{ return iterator(this, 0); };
+		const_iterator			begin() const 							{ return const_iterator(this, 0); };
+		iterator				end() 									{ return iterator(this, _size); };
+		const_iterator			end() const 							{ return const_iterator(this, _size); };
+		reverse_iterator		rbegin() 								{ return reverse_iterator(end()); };
+		const_reverse_iterator	rbegin() const 							{ return const_reverse_iterator(end()); };
+		reverse_iterator		rend() 									{ return reverse_iterator(begin()); };
+		const_reverse_iterator	rend() const 							{ return const_reverse_iterator(begin()); };
+
+		//-------------| Capacity |-------
+
+		bool					empty() const 							{ return _size == 0; };
+		size_type				size() const 							{ return _size; };
+		size_type				max_size() const 						{ return allocator.max_size(); };
+		size_type				capacity() const 						{ return _capacity * bits_per_word; };
+
+		void reserve(size_type bits) {
+			if (words_for(bits) > _capacity)
+				reallocate(words_for(bits));
+		};
+
+		void shrink_to_fit() {
+			if (_size == 0)
+				release_storage();
+			else if (words_for(_size) < _capacity)
+				reallocate(words_for(_size));
+		};
+
+		//-------------| Modifiers |-------
+
+		void clear() {
+			_size = 0;
+		};
+
+		void push_back(bool value) {
+			if (_size == capacity())
+				reallocate(G::grow(_capacity, words_for(_size + 1), sizeof(word_type)));
+			if (_size % bits_per_word == 0)
+				_words[_size / bits_per_word] = 0;
+			if (value)
+				_words[_size / bits_per_word] |= word_type(1) << (_size % bits_per_word);
+			++_size;
+		};
+
+		void pop_back() {
+			--_size;
+			_words[_size / bits_per_word] &= ~(word_type(1) << (_size % bits_per_word));
+		};
+
+		void resize(size_type count, bool value = false) {
+			if (count <= _size)
+			{
+				_size = count;
+				clear_tail();
+				return;
+			}
+			if (words_for(count) > _capacity)
+				reallocate(G::grow(_capacity, words_for(count), sizeof(word_type)));
+			fill_bits(_size, count, value);
+			_size = count;
+		};
+
+		iterator insert(const_iterator pos, bool value) {
+			size_type index = pos.index();
+
+			open_gap(index, 1);
+			(*this)[index] = value;
+			return iterator(this, index);
+		};
+
+		iterator insert(const_iterator pos, size_type count, bool value) {
+			size_type index = pos.index();
+
+			open_gap(index, count);
+			for (size_type i = index; i < index + count; ++i)
+				(*this)[i] = value;
+			return iterator(this, index);
+		};
+
+		template <class InputIterator>
+		typename ft::enable_if<!ft::is_integral<InputIterator>::value, iterator>::type
+		insert(const_iterator pos, InputIterator first, InputIterator last) {
+			size_type	index = pos.index();
+			vector		bits(first, last); // input iterators can only be read once
+
+			open_gap(index, bits._size);
+			for (size_type i = 0; i < bits._size; ++i)
+				(*this)[index + i] = bits[i];
+			return iterator(this, index);
+		};
+
+		iterator erase(const_iterator pos) {
+			return erase(pos, pos + 1);
+		};
+
+		iterator erase(const_iterator first, const_iterator last) {
+			size_type from = first.index();
+			size_type count = last.index() - from;
+
+			for (size_type i = from; i + count < _size; ++i)
+				(*this)[i] = bool((*this)[i + count]);
+			resize(_size - count);
+			return iterator(this, from);
+		};
+
+		void swap(vector& other) {
+			std::swap(_words, other._words);
+			std::swap(_capacity, other._capacity);
+			std::swap(_size, other._size);
+			std::swap(allocator, other.allocator);
+		};
+
+		static void swap(reference x, reference y) {
+			bool tmp = x;
+
+			x = y;
+			y = tmp;
+		};
+
+		void flip() {
+			for (size_type i = 0; i < words_for(_size); ++i)
+				_words[i] = ~_words[i];
+			clear_tail();
+		};
+
+		//-------------| Bitmap operations |-------
+
+		size_type count() const {
+			return ft::popcount_words(_words, words_for(_size));
+		};
+
+		//index of the first set bit, or size() if there is none
+		size_type find_first() const {
+			return find_from(0);
+		};
+
+		//index of the first set bit after pos, or size() if there is none
+		size_type find_next(size_type pos) const {
+			return find_from(pos + 1);
+		};
+
+		vector& operator&=(const vector& other) {
+			size_type n = common_words(other);
+
+			ft::combine_words<ft::bit_and>(_words, other._words, n);
+			if (words_for(_size) > n)
+				std::memset(static_cast<void*>(_words + n), 0, (words_for(_size) - n) * sizeof(word_type));
+			return *this;
+		};
+
+		vector& operator|=(const vector& other) {
+			ft::combine_words<ft::bit_or>(_words, other._words, common_words(other));
+			clear_tail();
+			return *this;
+		};
+
+		vector& operator^=(const vector& other) {
+			ft::combine_words<ft::bit_xor>(_words, other._words, common_words(other));
+			clear_tail();
+			return *this;
+		};
+
+	private:
+
+		static size_type words_for(size_type bits) {
+			return (bits + bits_per_word - 1) / bits_per_word;
+		}
+
+		size_type common_words(const vector& other) const {
+			return words_for(_size < other._size ? _size : other._size);
+		}
+
+		//moves the used words to a block of words words
+		void reallocate(size_type words) {
+			word_type* tmp = allocator.allocate(words);
+
+			if (_size)
+				std::memcpy(static_cast<void*>(tmp), static_cast<const void*>(_words), words_for(_size) * sizeof(word_type));
+			release_storage();
+			_words = tmp;
+			_capacity = words;
+		}
+
+		void release_storage() {
+			if (_words)
+				allocator.deallocate(_words, _capacity);
+			_words = 0;
+			_capacity = 0;
+		}
+
+		//this vector is empty and has room for other
+		void copy_words(const vector& other) {
+			if (other._size)
+				std::memcpy(static_cast<void*>(_words), static_cast<const void*>(other._words), words_for(other._size) * sizeof(word_type));
+			_size = other._size;
+		}
+
+		//zeroes the bits past size() in the last word
+		void clear_tail() {
+			if (_size % bits_per_word)
+				_words[_size / bits_per_word] &= ft::bit_range(0, _size % bits_per_word);
+		}
+
+		//Sets bits [from, to) to value, whole words at a time. The word holding
+		//from has its bits from on at 0; the words after it are raw.
+		void fill_bits(size_type from, size_type to, bool value) {
+			size_type w = from / bits_per_word;
+
+			if (from % bits_per_word)
+			{
+				size_type hi = to - w * bits_per_word < bits_per_word ? to - w * bits_per_word : bits_per_word;
+
+				if (value)
+					_words[w] |= ft::bit_range(from % bits_per_word, hi);
+				++w;
+			}
+			if (w * bits_per_word >= to)
+				return;
+			std::memset(static_cast<void*>(_words + w), value ? 0xFF : 0, (to / bits_per_word - w) * sizeof(word_type));
+			if (to % bits_per_word)
+				_words[to / bits_per_word] = value ? ft::bit_range(0, to % bits_per_word) : 0;
+		}
+
+		//makes room for count bits at index, moving the bits after it up
+		void open_gap(size_type index, size_type count) {
+			size_type old = _size;
+
+			resize(_size + count);
+			for (size_type i = old; i > index; --i)
+				(*this)[i - 1 + count] = bool((*this)[i - 1]);
+		}
+
+		size_type find_from(size_type pos) const {
+			if (pos >= _size)
+				return _size;
+
+			size_type	w = pos / bits_per_word;
+			size_type	last = words_for(_size);
+			word_type	word = _words[w] & ~ft::bit_range(0, pos % bits_per_word);
+
+			while (word == 0)
+			{
+				if (++w == last)
+					return _size;
+				word = _words[w];
+			}
+			return w * bits_per_word + ft::lowest_bit(word);
+		}
+	};
+
+	template <class A, class G>
+	bool operator==(const ft::vector<bool, A, G>& lhs, const ft::vector<bool, A, G>& rhs) {
+		return lhs.size() == rhs.size()
+			&& (lhs.size() == 0 || std::memcmp(lhs.words(), rhs.words(), lhs.word_count() * sizeof(ft::bit_word)) == 0);
+	}
+
+	template <class A, class G>
+	bool operator!=(const ft::vector<bool, A, G>& lhs, const ft::vector<bool, A, G>& rhs) {
+		return !(lhs == rhs);
+	}
+}
+
+#endif //_VECTOR_BOOL_HPP_